@@ -18,16 +18,62 @@
 
 #include "PowerPlant.hpp"
 
+#include <algorithm>
+#include <array>
+
 #include "threading/ThreadPoolTask.hpp"
+#include "util/powerplant_slots.hpp"
+#include "util/update_current_thread_affinity.hpp"
 
 namespace NUClear {
 
 PowerPlant* PowerPlant::powerplant = nullptr;  // NOLINT
 
+namespace {
+    /// @brief The powerplants that are using each slot in the stores
+    std::array<PowerPlant*, util::max_powerplants> slots = {};  // NOLINT
+    /// @brief A mutex protecting the slots and the first powerplant
+    std::mutex slot_mutex;  // NOLINT
+}  // namespace
+
+size_t PowerPlant::acquire_slot(PowerPlant* plant) {
+
+    std::lock_guard<std::mutex> lock(slot_mutex);
+
+    auto slot = std::find(slots.begin(), slots.end(), nullptr);
+    if (slot == slots.end()) {
+        throw std::runtime_error("There are too many powerplants in existence (util::max_powerplants)");
+    }
+
+    *slot = plant;
+    if (powerplant == nullptr) { powerplant = plant; }
+
+    return size_t(std::distance(slots.begin(), slot));
+}
+
+void PowerPlant::release_slot(PowerPlant* plant) {
+
+    // Clear everything the stores kept for us while the slot is still ours, so the next PowerPlant starts empty
+    util::reset_slot(plant->id);
+
+    std::lock_guard<std::mutex> lock(slot_mutex);
+
+    slots[plant->id] = nullptr;
+
+    // If we were the first powerplant, hand over to one that is still around
+    if (powerplant == plant) {
+        auto next  = std::find_if(slots.begin(), slots.end(), [](PowerPlant* p) { return p != nullptr; });
+        powerplant = next == slots.end() ? nullptr : *next;
+    }
+}
+
 PowerPlant::~PowerPlant() {
 
+    // Destroy our reactors first so there is nothing left that could put data back into our slot
+    reactors.clear();
+
     // Bye bye powerplant
-    powerplant = nullptr;
+    release_slot(this);
 }
 
 void PowerPlant::on_startup(std::function<void()>&& func) {
@@ -43,6 +89,9 @@ void PowerPlant::add_thread_task(std::function<void()>&& task) {
 
 void PowerPlant::start() {
 
+    // Whichever thread starts us becomes our main thread
+    main_thread_id = std::this_thread::get_id();
+
     // We are now running
     is_running = true;
 
@@ -57,7 +106,16 @@ void PowerPlant::start() {
 
     // Start all our threads
     for (size_t i = 0; i < configuration.thread_count; ++i) {
-        tasks.push_back(threading::make_thread_pool_task(scheduler));
+        auto pool_task = threading::make_thread_pool_task(scheduler);
+
+        // Keep our pool threads on our own CPUs if we were asked to
+        if (configuration.cpu_affinity.empty()) { tasks.push_back(pool_task); }
+        else {
+            tasks.push_back([this, pool_task] {
+                update_current_thread_affinity(configuration.cpu_affinity);
+                pool_task();
+            });
+        }
     }
 
     // Start all our tasks
@@ -78,6 +136,9 @@ void PowerPlant::start() {
         catch (const std::system_error&) {
         }
     }
+
+    // Anything logged after the log controller stopped is still waiting to be emitted
+    if (configuration.async_logging) { flush_logs(); }
 }
 
 void PowerPlant::submit(std::unique_ptr<threading::ReactionTask>&& task) {
@@ -88,6 +149,82 @@ void PowerPlant::submit_main(std::unique_ptr<threading::ReactionTask>&& task) {
     main_thread_scheduler.submit(std::forward<std::unique_ptr<threading::ReactionTask>>(task));
 }
 
+void PowerPlant::emit_statistics(threading::ReactionTask& task) {
+    PowerPlant& plant = task.parent.reactor.powerplant;
+
+    if (plant.configuration.statistics_period > clock::duration(0)) { plant.statistics.record(*task.stats); }
+
+    size_t rate = plant.configuration.statistics_sample_rate;
+    if (rate != 0 && task.id % rate == 0) { plant.emit<dsl::word::emit::Direct>(task.stats); }
+}
+
+void PowerPlant::add_idle_task(const std::shared_ptr<threading::Reaction>& reaction) {
+    scheduler.add_idle_task(reaction);
+}
+
+void PowerPlant::remove_idle_task(uint64_t id) {
+    scheduler.remove_idle_task(id);
+}
+
+void PowerPlant::parallel(size_t count, const std::function<void(size_t)>& chunk) {
+
+    struct State {
+        State(const std::function<void(size_t)>& chunk, size_t count) : chunk(chunk), count(count) {}
+
+        /// The function that runs each chunk, only valid until all chunks have finished
+        const std::function<void(size_t)>& chunk;
+        /// The number of chunks to run
+        const size_t count;
+        /// The next chunk that has not been claimed by a thread
+        std::atomic<size_t> next{0};
+        /// The number of chunks that have finished
+        size_t finished = 0;
+        /// The first exception thrown by a chunk
+        std::exception_ptr exception;
+        std::mutex mutex;
+        std::condition_variable condition;
+    };
+
+    auto state = std::make_shared<State>(chunk, count);
+
+    // Run chunks until they have all been claimed. Helpers that start late will find nothing to do, and as every
+    // claimed chunk is being actively run we never wait on work that is stuck in the queue
+    auto work = [state] {
+        for (size_t i = state->next++; i < state->count; i = state->next++) {
+            try {
+                state->chunk(i);
+            }
+            catch (...) {
+                std::lock_guard<std::mutex> lock(state->mutex);
+                if (!state->exception) { state->exception = std::current_exception(); }
+            }
+
+            std::lock_guard<std::mutex> lock(state->mutex);
+            if (++state->finished == state->count) { state->condition.notify_all(); }
+        }
+    };
+
+    // Submit helpers as children of the current task, if we aren't in a task there is nothing to make them from
+    const auto* current = threading::ReactionTask::get_current_task();
+    if (current != nullptr) {
+        for (size_t i = 1; i < count && i <= configuration.thread_count; ++i) {
+            submit(std::make_unique<threading::ReactionTask>(
+                current->parent, current->priority, [work](std::unique_ptr<threading::ReactionTask>&& task) {
+                    work();
+                    return std::move(task);
+                }));
+        }
+    }
+
+    // Help out until everything is claimed, then wait for the other threads to finish theirs
+    work();
+
+    std::unique_lock<std::mutex> lock(state->mutex);
+    state->condition.wait(lock, [&state] { return state->finished == state->count; });
+
+    if (state->exception) { std::rethrow_exception(state->exception); }
+}
+
 void PowerPlant::shutdown() {
 
     // Stop running before we emit events the Shutdown event
@@ -102,9 +239,21 @@ void PowerPlant::shutdown() {
 
     // Shutdown the main threads scheduler
     main_thread_scheduler.shutdown();
+}
 
-    // Bye bye powerplant
-    powerplant = nullptr;
+void PowerPlant::flush_logs() {
+    logs.consume([this](const LogLevel& level, std::string message, const message::ReactionStatistics* task) {
+        emit<dsl::word::emit::Direct>(
+            std::make_unique<message::LogMessage>(message::LogMessage{level, std::move(message), task}));
+    });
+
+    uint64_t dropped = logs.dropped();
+    if (dropped > 0) {
+        emit<dsl::word::emit::Direct>(std::make_unique<message::LogMessage>(message::LogMessage{
+            NUClear::WARN,
+            std::to_string(dropped) + " log messages were dropped as the log queue was full",
+            nullptr}));
+    }
 }
 
 bool PowerPlant::running() {
@@ -19,6 +19,7 @@
 #ifndef NUCLEAR_POWERPLANT_HPP
 #define NUCLEAR_POWERPLANT_HPP
 
+#include <deque>
 #include <iostream>
 #include <map>
 #include <memory>
@@ -34,6 +35,8 @@
 // Utilities
 #include "LogLevel.hpp"
 #include "message/LogMessage.hpp"
+#include "threading/LogQueue.hpp"
+#include "threading/StatisticsAggregator.hpp"
 #include "threading/TaskScheduler.hpp"
 #include "util/FunctionFusion.hpp"
 #include "util/demangle.hpp"
@@ -51,6 +54,10 @@ class Reactor;
  *  At the centre of every NUClear system is a PowerPlant. A PowerPlant contains all of the reactors that are
  *  used within the system and sets up their reactions. It is also responsible for storing information between
  *  reactions and ensuring that all threading is handled appropriately.
+ *
+ *  Several PowerPlants can exist in one process at the same time (up to util::max_powerplants). Each has its own
+ *  threads and its own copy of the data and reactions in the stores, so they can be used to run independent
+ *  workloads side by side without interfering with each other.
  */
 class PowerPlant {
     // Reactors and PowerPlants are very tightly linked
@@ -66,17 +73,40 @@ public:
     struct Configuration {
         /// @brief default to the amount of hardware concurrency (or 2) threads
         Configuration()
-            : thread_count(std::thread::hardware_concurrency() == 0 ? 2 : std::thread::hardware_concurrency()) {}
+            : thread_count(std::thread::hardware_concurrency() == 0 ? 2 : std::thread::hardware_concurrency())
+            , idle_thread_count(1)
+            , statistics_period(0)
+            , statistics_sample_rate(1)
+            , async_logging(false) {}
 
         /// @brief The number of threads the system will use
         size_t thread_count;
+        /// @brief The number of pool threads that can be running Idle reactions at the same time
+        size_t idle_thread_count;
+        /// @brief If not empty, the pool threads will only be run on these CPUs
+        std::vector<unsigned int> cpu_affinity;
+        /// @brief If not zero, a ReactionStatisticsSummary of the tasks that ran is emitted this often, along with
+        /// LockStatistics when built with NUCLEAR_PROFILE_LOCKS
+        clock::duration statistics_period;
+        /// @brief ReactionStatistics are emitted for one in this many tasks, or for none if this is zero
+        size_t statistics_sample_rate;
+        /// @brief If true, log messages are formatted and emitted on a background thread rather than by the thread
+        /// that logs them, so logging never waits on the reactions that handle LogMessages
+        bool async_logging;
     };
 
     /// @brief Holds the configuration information for this PowerPlant (such as number of pool threads)
     const Configuration configuration;
-
-
-    // There can only be one powerplant, so this is it
+    /// @brief The slot of this PowerPlant in the stores, each PowerPlant that exists at the same time has its own
+    const size_t id;
+    /// @brief The thread that runs the MainThread tasks for this PowerPlant, which is the thread that calls start
+    std::thread::id main_thread_id;
+    /// @brief Aggregates the statistics of the tasks that have run when statistics_period is set
+    threading::StatisticsAggregator statistics;
+    /// @brief Holds the log messages waiting to be emitted when async_logging is set
+    threading::LogQueue logs;
+
+    // The first powerplant that was made, used when there is no other way to tell which powerplant to use
     static PowerPlant* powerplant;
 
     /**
@@ -99,7 +129,8 @@ public:
      *  Starts up the PowerPlant instance and starts all the pool threads. This
      *  method is blocking and will release when the PowerPlant shuts down.
      *  It should only be called from the main thread so that statics are not
-     *  destructed.
+     *  destructed. When running several PowerPlants, each should be started
+     *  from its own thread.
      */
     void start();
 
@@ -109,6 +140,15 @@ public:
      */
     void shutdown();
 
+    /**
+     * @brief Emits the log messages waiting in the queue when async_logging is set.
+     *
+     * @details
+     *  The log controller calls this as messages are queued. start calls it once more after every thread has
+     *  stopped, so messages logged by Shutdown reactions that ran after the log controller's are still emitted.
+     */
+    void flush_logs();
+
     /**
      * TODO document
      */
@@ -152,12 +192,88 @@ public:
      */
     void submit_main(std::unique_ptr<threading::ReactionTask>&& task);
 
+    /**
+     * @brief Emits the statistics of a task that has finished into the PowerPlant that ran it.
+     *
+     * @details
+     *  The statistics are added to the PowerPlant's summary if statistics_period is set, and only emitted for the
+     *  tasks that are sampled by statistics_sample_rate.
+     *
+     * @param task the task that has finished running
+     */
+    static void emit_statistics(threading::ReactionTask& task);
+
+    /**
+     * @brief Adds a reaction that the ThreadPool will run when it has nothing else to do.
+     *
+     * @param reaction the reaction to run when idle
+     */
+    void add_idle_task(const std::shared_ptr<threading::Reaction>& reaction);
+
+    /**
+     * @brief Stops a reaction from being run by the ThreadPool when it has nothing else to do.
+     *
+     * @param id the id of the reaction to stop running
+     */
+    void remove_idle_task(uint64_t id);
+
+    /**
+     * @brief Runs a function for every index in a range, splitting the work across the thread pool.
+     *
+     * @details
+     *  The range is split into chunks of grain indices, which are run by helper tasks submitted to the thread pool.
+     *  The calling thread also runs chunks while it waits, so this will never deadlock even if every pool thread is
+     *  busy, and it can be used from inside other parallel loops. When called from outside a reaction all of the
+     *  work is done by the calling thread.
+     *
+     *  This function returns once every index has been run. If the function throws, the first exception is rethrown
+     *  once the rest of the work has finished.
+     *
+     * @tparam Index    the integral type of the indices
+     * @tparam Function the type of the function to run, it is called as function(Index)
+     *
+     * @param begin     the first index to run
+     * @param end       one past the last index to run
+     * @param grain     the number of indices to run in each chunk
+     * @param function  the function to run for each index
+     */
+    template <typename Index, typename Function>
+    void parallel_for(Index begin, Index end, Index grain, Function&& function);
+
+    /**
+     * @brief Maps a function over every index in a range and reduces the results, splitting the work across the
+     *        thread pool.
+     *
+     * @details
+     *  This splits the work in the same way as parallel_for. Each chunk reduces its own results starting from
+     *  identity, and then the results of the chunks are reduced in order. As the chunks are reduced in order, the
+     *  reduce function needs to be associative but does not need to be commutative.
+     *
+     * @tparam Index    the integral type of the indices
+     * @tparam T        the type of the result
+     * @tparam Map      the type of the map function, it is called as map(Index) and returns a T
+     * @tparam Reduce   the type of the reduce function, it is called as reduce(T, T) and returns a T
+     *
+     * @param begin     the first index to run
+     * @param end       one past the last index to run
+     * @param grain     the number of indices to run in each chunk
+     * @param identity  the identity value for the reduce function
+     * @param map       the function that gets the value for each index
+     * @param reduce    the function that combines two values
+     *
+     * @return the reduced value
+     */
+    template <typename Index, typename T, typename Map, typename Reduce>
+    T parallel_reduce(Index begin, Index end, Index grain, T identity, Map&& map, Reduce&& reduce);
+
     /**
      * @brief Log a message through NUClear's system.
      *
      * @details
      *  Logs a message through the system so the various log handlers
-     *  can access it.
+     *  can access it. Nothing is formatted if no reactions handle LogMessages.
+     *  When async_logging is set the arguments are queued and the message is
+     *  formatted and emitted later by a background thread.
      *
      * @tparam level     The level to log at (defaults to DEBUG)
      * @tparam Arguments The types of the arguments we are logging
@@ -223,6 +339,33 @@ public:
     void emit(Arguments&&... args);
 
 private:
+    /**
+     * @brief Runs a number of chunks of work using the calling thread and helper tasks in the thread pool.
+     *
+     * @param count the number of chunks to run
+     * @param chunk the function that runs a chunk given its index
+     */
+    void parallel(size_t count, const std::function<void(size_t)>& chunk);
+
+    /**
+     * @brief Claims a free slot in the stores for a new PowerPlant.
+     *
+     * @param plant the PowerPlant that is claiming the slot
+     *
+     * @return the index of the slot
+     */
+    static size_t acquire_slot(PowerPlant* plant);
+
+    /**
+     * @brief Gives back the slot that a PowerPlant was using so another can use it.
+     *
+     * @details Everything the stores kept for the slot is cleared first, so the next PowerPlant to use the slot does
+     *          not see any of the data from this one.
+     *
+     * @param plant the PowerPlant that is being destroyed
+     */
+    static void release_slot(PowerPlant* plant);
+
     /// @brief A list of tasks that must be run when the powerplant starts up
     std::vector<std::function<void()>> tasks;
     /// @brief A vector of the running threads in the system
@@ -239,11 +382,9 @@ private:
     volatile bool is_running = false;
 };
 
-// This free floating log function can be called from anywhere and will use the singleton PowerPlant
+// This free floating log function can be called from anywhere and will use the PowerPlant of the current task
 template <enum LogLevel level = NUClear::DEBUG, typename... Arguments>
-void log(Arguments&&... args) {
-    PowerPlant::log<level>(std::forward<Arguments>(args)...);
-}
+void log(Arguments&&... args);
 
 }  // namespace NUClear
 
@@ -253,8 +394,12 @@ void log(Arguments&&... args) {
 #include "dsl/word/emit/Initialise.hpp"
 #include "dsl/word/emit/Local.hpp"
 #include "message/CommandLineArguments.hpp"
+#include "message/LockStatistics.hpp"
 #include "message/NetworkConfiguration.hpp"
 #include "message/NetworkEvent.hpp"
+#include "message/PersistenceConfiguration.hpp"
+#include "message/ReactionStatisticsSummary.hpp"
+#include "message/TraceConfiguration.hpp"
 
 // Include all of our implementation files (which use the previously included reactor.h)
 #include "PowerPlant.ipp"
@@ -18,24 +18,30 @@
 
 #include "extension/ChronoController.hpp"
 #include "extension/IOController.hpp"
+#include "extension/IPCController.hpp"
+#include "extension/LogController.hpp"
 #include "extension/NetworkController.hpp"
+#include "extension/PersistenceController.hpp"
+#include "extension/StatisticsController.hpp"
+#include "extension/TraceController.hpp"
 
 namespace NUClear {
 
-inline PowerPlant::PowerPlant(Configuration config, int argc, const char* argv[]) : configuration(config) {
-
-    // Stop people from making more then one powerplant
-    if (powerplant != nullptr) {
-        throw std::runtime_error("There is already a powerplant in existence (There should be a single PowerPlant)");
-    }
-
-    // Store our static variable
-    powerplant = this;
+inline PowerPlant::PowerPlant(Configuration config, int argc, const char* argv[])
+    : configuration(config)
+    , id(acquire_slot(this))
+    , main_thread_id(std::this_thread::get_id())
+    , scheduler(config.idle_thread_count) {
 
     // Install the Chrono reactor
     install<extension::ChronoController>();
     install<extension::IOController>();
     install<extension::NetworkController>();
+    install<extension::IPCController>();
+    install<extension::PersistenceController>();
+    install<extension::StatisticsController>();
+    install<extension::TraceController>();
+    install<extension::LogController>();
 
     // Emit our arguments if any.
     message::CommandLineArguments args;
@@ -59,6 +65,50 @@ void PowerPlant::install() {
         std::make_unique<T>(std::make_unique<Environment>(*this, util::demangle(typeid(T).name()), level)));
 }
 
+template <typename Index, typename Function>
+void PowerPlant::parallel_for(Index begin, Index end, Index grain, Function&& function) {
+
+    if (end <= begin) { return; }
+    if (grain < Index(1)) { grain = Index(1); }
+
+    parallel(size_t((end - begin + grain - 1) / grain), [&](size_t c) {
+        Index first = begin + Index(c) * grain;
+        Index last  = end - first < grain ? end : first + grain;
+
+        for (Index i = first; i < last; ++i) {
+            function(i);
+        }
+    });
+}
+
+template <typename Index, typename T, typename Map, typename Reduce>
+T PowerPlant::parallel_reduce(Index begin, Index end, Index grain, T identity, Map&& map, Reduce&& reduce) {
+
+    if (end <= begin) { return identity; }
+    if (grain < Index(1)) { grain = Index(1); }
+
+    // Each chunk writes its own result (a deque so that even bools can be written from different threads)
+    std::deque<T> results(size_t((end - begin + grain - 1) / grain), identity);
+
+    parallel(results.size(), [&](size_t c) {
+        Index first = begin + Index(c) * grain;
+        Index last  = end - first < grain ? end : first + grain;
+
+        T value = identity;
+        for (Index i = first; i < last; ++i) {
+            value = reduce(std::move(value), map(i));
+        }
+        results[c] = std::move(value);
+    });
+
+    // Reduce the chunks in order
+    T value = std::move(identity);
+    for (auto& result : results) {
+        value = reduce(std::move(value), std::move(result));
+    }
+    return value;
+}
+
 // Default emit with no types
 template <typename T>
 void PowerPlant::emit(std::unique_ptr<T>&& data) {
@@ -163,17 +213,40 @@ namespace {
 template <enum LogLevel level, typename... Arguments>
 void PowerPlant::log(Arguments&&... args) {
 
+    auto current_task = threading::ReactionTask::get_current_task();
+
+    // Log into the powerplant that is running this task, if we are not in a task we can only use the first one
+    PowerPlant& plant = current_task ? current_task->parent.reactor.powerplant : *powerplant;
+
+    // If nothing handles log messages there is no point making one
+    if (dsl::store::TypeCallbackStore<message::LogMessage>::get(plant.id).empty()) { return; }
+
+    // Leave the formatting and emitting to the log controller's thread
+    if (plant.configuration.async_logging) {
+        plant.logs.push(level, current_task ? current_task->stats.get() : nullptr, std::forward<Arguments>(args)...);
+        return;
+    }
+
     // Build our log message by concatenating everything to a stream
     std::stringstream output_stream;
     log_impl(output_stream, std::forward<Arguments>(args)...);
     std::string output = output_stream.str();
 
-    auto current_task = threading::ReactionTask::get_current_task();
-    auto task         = current_task ? current_task->stats.get() : nullptr;
+    auto task = current_task ? current_task->stats.get() : nullptr;
 
     // Direct emit the log message so that any direct loggers can use it
-    powerplant->emit<dsl::word::emit::Direct>(
+    plant.emit<dsl::word::emit::Direct>(
         std::make_unique<message::LogMessage>(message::LogMessage{level, output, task}));
 }
 
+template <enum LogLevel level, typename... Arguments>
+void log(Arguments&&... args) {
+
+    // Check the level of the reactor that is logging before anything is formatted, the same as Reactor::log does
+    auto current_task = threading::ReactionTask::get_current_task();
+    if (current_task != nullptr && level < current_task->parent.reactor.log_level) { return; }
+
+    PowerPlant::log<level>(std::forward<Arguments>(args)...);
+}
+
 }  // namespace NUClear
@@ -44,6 +44,8 @@ namespace dsl {
 
         struct Always;
 
+        struct Idle;
+
         struct Priority;
 
         struct IO;
@@ -55,9 +57,21 @@ namespace dsl {
         template <typename...>
         struct Optional;
 
+        template <size_t, typename>
+        struct History;
+
         template <size_t, typename...>
         struct Last;
 
+        template <typename...>
+        struct Latest;
+
+        template <typename, size_t>
+        struct Nearest;
+
+        template <typename, size_t>
+        struct Between;
+
         struct MainThread;
 
         template <typename>
@@ -65,12 +79,35 @@ namespace dsl {
 
         struct NetworkSource;
 
+        template <typename>
+        struct IPC;
+
+        struct IPCSource;
+
         template <typename...>
         struct Trigger;
 
         template <typename...>
         struct With;
 
+        template <typename>
+        struct Persist;
+
+        template <typename...>
+        struct Join;
+
+        template <int, typename, typename...>
+        struct JoinWithin;
+
+        template <size_t, typename>
+        struct Batch;
+
+        template <int, typename, typename>
+        struct Window;
+
+        template <typename, size_t>
+        struct Channel;
+
         struct Startup;
 
         struct Shutdown;
@@ -81,11 +118,26 @@ namespace dsl {
         template <typename, int, typename>
         struct Watchdog;
 
+        template <int, typename>
+        struct Throttle;
+
+        template <int, typename>
+        struct Debounce;
+
         template <typename>
         struct Per;
 
         struct Single;
 
+        struct Inline;
+
+        struct CPUTime;
+
+        struct PerfCounters;
+
+        template <typename>
+        struct Filter;
+
         template <int>
         struct Buffer;
 
@@ -104,6 +156,8 @@ namespace dsl {
             template <typename T>
             struct Network;
             template <typename T>
+            struct IPC;
+            template <typename T>
             struct UDP;
             template <typename T>
             struct Watchdog;
@@ -128,6 +182,10 @@ class Reactor {
 public:
     friend class PowerPlant;
 
+    // The free floating log function checks the level of the reactor that is logging
+    template <enum LogLevel level, typename... Arguments>
+    friend void log(Arguments&&... args);
+
     Reactor(std::unique_ptr<Environment> environment)
         : reaction_handles()
         , powerplant(environment->powerplant)
@@ -172,6 +230,9 @@ protected:
     /// @copydoc dsl::word::Always
     using Always = dsl::word::Always;
 
+    /// @copydoc dsl::word::Idle
+    using Idle = dsl::word::Idle;
+
     /// @copydoc dsl::word::IO
     using IO = dsl::word::IO;
 
@@ -185,14 +246,54 @@ protected:
     template <typename... Ts>
     using With = dsl::word::With<Ts...>;
 
+    /// @copydoc dsl::word::Join
+    template <typename... Ts>
+    using Join = dsl::word::Join<Ts...>;
+
+    /// @copydoc dsl::word::JoinWithin
+    template <int ticks, class period, typename... Ts>
+    using JoinWithin = dsl::word::JoinWithin<ticks, period, Ts...>;
+
+    /// @copydoc dsl::word::Batch
+    template <size_t n, typename T>
+    using Batch = dsl::word::Batch<n, T>;
+
+    /// @copydoc dsl::word::Window
+    template <int ticks, class period, typename T>
+    using Window = dsl::word::Window<ticks, period, T>;
+
+    /// @copydoc dsl::word::Channel
+    template <typename T, size_t n = 1024>
+    using Channel = dsl::word::Channel<T, n>;
+
+    /// @copydoc dsl::word::Nearest
+    template <typename T, size_t n = 100>
+    using Nearest = dsl::word::Nearest<T, n>;
+
+    /// @copydoc dsl::word::Between
+    template <typename T, size_t n = 100>
+    using Between = dsl::word::Between<T, n>;
+
     /// @copydoc dsl::word::Optional
     template <typename... DSL>
     using Optional = dsl::word::Optional<DSL...>;
 
+    /// @copydoc dsl::word::Persist
+    template <typename T>
+    using Persist = dsl::word::Persist<T>;
+
+    /// @copydoc dsl::word::History
+    template <size_t len, typename T>
+    using History = dsl::word::History<len, T>;
+
     /// @copydoc dsl::word::Last
     template <size_t len, typename... DSL>
     using Last = dsl::word::Last<len, DSL...>;
 
+    /// @copydoc dsl::word::Latest
+    template <typename... DSL>
+    using Latest = dsl::word::Latest<DSL...>;
+
     /// @copydoc dsl::word::MainThread
     using MainThread = dsl::word::MainThread;
 
@@ -206,6 +307,13 @@ protected:
     /// @copydoc dsl::word::Network
     using NetworkSource = dsl::word::NetworkSource;
 
+    /// @copydoc dsl::word::IPC
+    template <typename T>
+    using IPC = dsl::word::IPC<T>;
+
+    /// @copydoc dsl::word::IPC
+    using IPCSource = dsl::word::IPCSource;
+
     /// @copydoc dsl::word::Shutdown
     using Shutdown = dsl::word::Shutdown;
 
@@ -217,6 +325,14 @@ protected:
     template <typename TWatchdog, int ticks, class period = std::chrono::milliseconds>
     using Watchdog = dsl::word::Watchdog<TWatchdog, ticks, period>;
 
+    /// @copydoc dsl::word::Throttle
+    template <int ticks, class period = std::chrono::milliseconds>
+    using Throttle = dsl::word::Throttle<ticks, period>;
+
+    /// @copydoc dsl::word::Debounce
+    template <int ticks, class period = std::chrono::milliseconds>
+    using Debounce = dsl::word::Debounce<ticks, period>;
+
     /// @copydoc dsl::word::emit::ServiceWatchdog
     template <typename WatchdogGroup, typename... Arguments>
     auto ServiceWatchdog(Arguments&&... args)
@@ -237,10 +353,23 @@ protected:
     /// @copydoc dsl::word::Single
     using Single = dsl::word::Single;
 
+    /// @copydoc dsl::word::Inline
+    using Inline = dsl::word::Inline;
+
+    /// @copydoc dsl::word::CPUTime
+    using CPUTime = dsl::word::CPUTime;
+
+    /// @copydoc dsl::word::PerfCounters
+    using PerfCounters = dsl::word::PerfCounters;
+
     /// @copydoc dsl::word::Buffer
     template <int N>
     using Buffer = dsl::word::Buffer<N>;
 
+    /// @copydoc dsl::word::Filter
+    template <typename Predicate>
+    using Filter = dsl::word::Filter<Predicate>;
+
     struct Scope {
         /// @copydoc dsl::word::emit::Local
         template <typename T>
@@ -262,6 +391,10 @@ protected:
         template <typename T>
         using NETWORK = dsl::word::emit::Network<T>;
 
+        /// @copydoc dsl::word::emit::IPC
+        template <typename T>
+        using IPC = dsl::word::emit::IPC<T>;
+
         /// @copydoc dsl::word::emit::UDP
         template <typename T>
         using UDP = dsl::word::emit::UDP<T>;
@@ -399,25 +532,43 @@ public:
 
 // Domain Specific Language
 #include "dsl/word/Always.hpp"
+#include "dsl/word/Batch.hpp"
+#include "dsl/word/Between.hpp"
 #include "dsl/word/Buffer.hpp"
+#include "dsl/word/CPUTime.hpp"
+#include "dsl/word/Channel.hpp"
+#include "dsl/word/Debounce.hpp"
 #include "dsl/word/Every.hpp"
+#include "dsl/word/Filter.hpp"
+#include "dsl/word/History.hpp"
 #include "dsl/word/IO.hpp"
+#include "dsl/word/IPC.hpp"
+#include "dsl/word/Idle.hpp"
+#include "dsl/word/Inline.hpp"
+#include "dsl/word/Join.hpp"
 #include "dsl/word/Last.hpp"
+#include "dsl/word/Latest.hpp"
 #include "dsl/word/MainThread.hpp"
+#include "dsl/word/Nearest.hpp"
 #include "dsl/word/Network.hpp"
 #include "dsl/word/Optional.hpp"
+#include "dsl/word/PerfCounters.hpp"
+#include "dsl/word/Persist.hpp"
 #include "dsl/word/Priority.hpp"
 #include "dsl/word/Shutdown.hpp"
 #include "dsl/word/Single.hpp"
 #include "dsl/word/Startup.hpp"
 #include "dsl/word/Sync.hpp"
 #include "dsl/word/TCP.hpp"
+#include "dsl/word/Throttle.hpp"
 #include "dsl/word/Trigger.hpp"
 #include "dsl/word/UDP.hpp"
 #include "dsl/word/Watchdog.hpp"
+#include "dsl/word/Window.hpp"
 #include "dsl/word/With.hpp"
 #include "dsl/word/emit/Delay.hpp"
 #include "dsl/word/emit/Direct.hpp"
+#include "dsl/word/emit/IPC.hpp"
 #include "dsl/word/emit/Initialise.hpp"
 #include "dsl/word/emit/Local.hpp"
 #include "dsl/word/emit/Network.hpp"
@@ -21,6 +21,8 @@
 
 #include "../threading/ReactionHandle.hpp"
 #include "fusion/BindFusion.hpp"
+#include "fusion/CommitFusion.hpp"
+#include "fusion/FilterFusion.hpp"
 #include "fusion/GetFusion.hpp"
 #include "fusion/PostconditionFusion.hpp"
 #include "fusion/PreconditionFusion.hpp"
@@ -34,6 +36,8 @@ namespace dsl {
     struct Fusion : public fusion::BindFusion<Words...>,
                     public fusion::GetFusion<Words...>,
                     public fusion::PreconditionFusion<Words...>,
+                    public fusion::FilterFusion<Words...>,
+                    public fusion::CommitFusion<Words...>,
                     public fusion::PriorityFusion<Words...>,
                     public fusion::RescheduleFusion<Words...>,
                     public fusion::PostconditionFusion<Words...> {};
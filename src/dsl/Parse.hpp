@@ -47,6 +47,17 @@ namespace dsl {
                 Parse<Sentence...>>(r);
         }
 
+        template <typename Data>
+        static inline bool filter(threading::Reaction& r, const Data& data) {
+            return std::conditional_t<fusion::has_filter<DSL>::value, DSL, fusion::NoOp>::template filter<
+                Parse<Sentence...>>(r, data);
+        }
+
+        static inline bool commit(threading::Reaction& r) {
+            return std::conditional_t<fusion::has_commit<DSL>::value, DSL, fusion::NoOp>::template commit<
+                Parse<Sentence...>>(r);
+        }
+
         static inline int priority(threading::Reaction& r) {
             return std::conditional_t<fusion::has_priority<DSL>::value, DSL, fusion::NoOp>::template priority<
                 Parse<Sentence...>>(r);
@@ -0,0 +1,104 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NUCLEAR_DSL_FUSION_COMMITFUSION_HPP
+#define NUCLEAR_DSL_FUSION_COMMITFUSION_HPP
+
+#include "../../threading/Reaction.hpp"
+#include "../operation/DSLProxy.hpp"
+#include "has_commit.hpp"
+
+namespace NUClear {
+namespace dsl {
+    namespace fusion {
+
+        /// Type that redirects types without a commit function to their proxy type
+        template <typename Word>
+        struct Commit {
+            using type = std::conditional_t<has_commit<Word>::value, Word, operation::DSLProxy<Word>>;
+        };
+
+        template <typename, typename = std::tuple<>>
+        struct CommitWords;
+
+        /**
+         * @brief Metafunction that extracts all of the Words with a commit function
+         *
+         * @tparam Word1        The word we are looking at
+         * @tparam WordN        The words we have yet to look at
+         * @tparam FoundWords   The words we have found with commit functions
+         */
+        template <typename Word1, typename... WordN, typename... FoundWords>
+        struct CommitWords<std::tuple<Word1, WordN...>, std::tuple<FoundWords...>>
+            : public std::conditional_t<
+                  has_commit<typename Commit<Word1>::type>::value,
+                  /*T*/ CommitWords<std::tuple<WordN...>, std::tuple<FoundWords..., typename Commit<Word1>::type>>,
+                  /*F*/ CommitWords<std::tuple<WordN...>, std::tuple<FoundWords...>>> {};
+
+        /**
+         * @brief Termination case for the CommitWords metafunction
+         *
+         * @tparam FoundWords The words we have found with commit functions
+         */
+        template <typename... FoundWords>
+        struct CommitWords<std::tuple<>, std::tuple<FoundWords...>> {
+            using type = std::tuple<FoundWords...>;
+        };
+
+
+        // Default case where there are no commit words
+        template <typename Words>
+        struct CommitFuser {};
+
+        // Case where there is only a single word remaining
+        template <typename Word>
+        struct CommitFuser<std::tuple<Word>> {
+
+            template <typename DSL>
+            static inline bool commit(threading::Reaction& reaction) {
+
+                // Run our remaining commit
+                return Word::template commit<DSL>(reaction);
+            }
+        };
+
+        // Case where there is more 2 more more words remaining
+        template <typename Word1, typename Word2, typename... WordN>
+        struct CommitFuser<std::tuple<Word1, Word2, WordN...>> {
+
+            template <typename DSL>
+            static inline bool commit(threading::Reaction& reaction) {
+
+                // Perform a recursive and operation ending with the first false
+                return Word1::template commit<DSL>(reaction)
+                       && CommitFuser<std::tuple<Word2, WordN...>>::template commit<DSL>(reaction);
+            }
+        };
+
+        /**
+         * @brief Fuses the commit functions of the words, which run once a task's data has been fetched and has passed
+         *        every filter, so a word can claim state for the task knowing nothing else will stop it being made.
+         */
+        template <typename Word1, typename... WordN>
+        struct CommitFusion : public CommitFuser<typename CommitWords<std::tuple<Word1, WordN...>>::type> {};
+
+    }  // namespace fusion
+}  // namespace dsl
+}  // namespace NUClear
+
+#endif  // NUCLEAR_DSL_FUSION_COMMITFUSION_HPP
@@ -44,6 +44,16 @@ namespace dsl {
                 return true;
             }
 
+            template <typename DSL, typename Data>
+            static inline bool filter(threading::Reaction&, const Data&) {
+                return true;
+            }
+
+            template <typename DSL>
+            static inline bool commit(threading::Reaction&) {
+                return true;
+            }
+
             template <typename DSL>
             static inline int priority(threading::Reaction&) {
                 return word::Priority::NORMAL::value;
@@ -72,6 +82,11 @@ namespace dsl {
 
             static inline bool precondition(threading::Reaction&);
 
+            template <typename Data>
+            static inline bool filter(threading::Reaction&, const Data&);
+
+            static inline bool commit(threading::Reaction&);
+
             static inline int priority(threading::Reaction&);
 
             static inline std::unique_ptr<threading::ReactionTask> reschedule(
@@ -38,10 +38,10 @@ namespace dsl {
         struct CacheGet {
 
             template <typename DSL, typename T = DataType>
-            static inline std::shared_ptr<const T> get(threading::Reaction&) {
+            static inline std::shared_ptr<const T> get(threading::Reaction& r) {
 
                 return store::ThreadStore<std::shared_ptr<T>>::value == nullptr
-                           ? store::DataStore<DataType>::get()
+                           ? store::DataStore<DataType>::get(r.reactor.powerplant.id)
                            : *store::ThreadStore<std::shared_ptr<T>>::value;
             }
         };
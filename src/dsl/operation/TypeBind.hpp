@@ -43,7 +43,7 @@ namespace dsl {
 
                 // Our unbinder to remove this reaction
                 reaction->unbinders.push_back([](threading::Reaction& r) {
-                    auto& vec = store::TypeCallbackStore<DataType>::get();
+                    auto& vec = store::TypeCallbackStore<DataType>::get(r.reactor.powerplant.id);
 
                     auto item = std::find_if(
                         std::begin(vec), std::end(vec), [&r](const std::shared_ptr<threading::Reaction>& item) {
@@ -55,7 +55,7 @@ namespace dsl {
                 });
 
                 // Create our reaction and store it in the TypeCallbackStore
-                store::TypeCallbackStore<DataType>::get().push_back(reaction);
+                store::TypeCallbackStore<DataType>::get(reaction->reactor.powerplant.id).push_back(reaction);
             }
         };
 
@@ -70,7 +70,7 @@ namespace dsl {
 
                 // Our unbinder to remove this reaction
                 reaction->unbinders.push_back([](threading::Reaction& r) {
-                    auto& vec = store::TypeCallbackStore<message::ReactionStatistics>::get();
+                    auto& vec = store::TypeCallbackStore<message::ReactionStatistics>::get(r.reactor.powerplant.id);
 
                     auto item = std::find_if(
                         std::begin(vec), std::end(vec), [&r](const std::shared_ptr<threading::Reaction>& item) {
@@ -82,7 +82,8 @@ namespace dsl {
                 });
 
                 // Create our reaction and store it in the TypeCallbackStore
-                store::TypeCallbackStore<message::ReactionStatistics>::get().push_back(reaction);
+                store::TypeCallbackStore<message::ReactionStatistics>::get(reaction->reactor.powerplant.id)
+                    .push_back(reaction);
             }
         };
 
@@ -19,9 +19,12 @@
 #ifndef NUCLEAR_DSL_STORE_DATASTORE_HPP
 #define NUCLEAR_DSL_STORE_DATASTORE_HPP
 
+#include <array>
 #include <memory>
+#include <mutex>
 
-#include "../../util/TypeMap.hpp"
+#include "../../util/Mutex.hpp"
+#include "../../util/powerplant_slots.hpp"
 
 namespace NUClear {
 namespace dsl {
@@ -33,11 +36,67 @@ namespace dsl {
          * @details This datastore is the main one used by the system. When data is emitted it is stored in this
          *          typed datastore. This allows constant time access to any datatype without having to look it up.
          *          This is possible as the exact location of the store is known at compile time.
+         *          Each PowerPlant has its own slot in the store so that several can run in one process without
+         *          seeing each other's data.
          *
          * @tparam DataType the type of data stored in this paticular datastore location
          */
         template <typename DataType>
-        using DataStore = util::TypeMap<DataType, DataType, DataType>;
+        class DataStore {
+        private:
+            /// @brief Deleted constructor as this class is a static class.
+            DataStore() = delete;
+            /// @brief Deleted destructor as this class is a static class.
+            ~DataStore() = delete;
+
+            /// @brief the latest data emitted for each PowerPlant
+            static std::array<std::shared_ptr<DataType>, util::max_powerplants> data;
+            /// @brief the lock on one PowerPlant's data
+            struct Lock {
+                util::Mutex mutex{"DataStore", &util::lock_key<DataType>};
+            };
+
+            /// @brief a lock for each PowerPlant's data so that PowerPlants do not contend with each other
+            static std::array<Lock, util::max_powerplants> locks;
+
+            /// @brief clears the data of a destroyed PowerPlant so the next to use its slot starts empty
+            static void reset(size_t plant) {
+                std::shared_ptr<DataType> old;
+                std::lock_guard<util::Mutex> lock(locks[plant].mutex);
+                std::swap(old, data[plant]);
+            }
+
+        public:
+            /**
+             * @brief Stores the passed value as the latest data for a PowerPlant.
+             *
+             * @param plant the slot of the PowerPlant that the data was emitted in
+             * @param d     a pointer to the data to be stored
+             */
+            static void set(size_t plant, std::shared_ptr<DataType> d) {
+                static const util::SlotReset registered(&DataStore::reset);
+                std::lock_guard<util::Mutex> lock(locks[plant].mutex);
+                data[plant] = std::move(d);
+            }
+
+            /**
+             * @brief Gets the latest data that was stored for a PowerPlant.
+             *
+             * @param plant the slot of the PowerPlant to get the data from
+             *
+             * @return a shared_ptr to the data that was previously stored
+             */
+            static std::shared_ptr<DataType> get(size_t plant) {
+                std::lock_guard<util::Mutex> lock(locks[plant].mutex);
+                return data[plant];
+            }
+        };
+
+        template <typename DataType>
+        std::array<std::shared_ptr<DataType>, util::max_powerplants> DataStore<DataType>::data;
+
+        template <typename DataType>
+        std::array<typename DataStore<DataType>::Lock, util::max_powerplants> DataStore<DataType>::locks;
 
     }  // namespace store
 }  // namespace dsl
@@ -0,0 +1,178 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NUCLEAR_DSL_STORE_HISTORYSTORE_HPP
+#define NUCLEAR_DSL_STORE_HISTORYSTORE_HPP
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <memory>
+#include <mutex>
+
+#include "../../util/Mutex.hpp"
+#include "../../util/powerplant_slots.hpp"
+
+namespace NUClear {
+namespace dsl {
+    namespace store {
+
+        /**
+         * @brief Stores a bounded history of the data that has been emitted for a type.
+         *
+         * @details This store keeps the last n emissions of a type so that reactions can access them without having
+         *          to copy them into each task. The data is kept in append only blocks which hold twice the requested
+         *          history. Once a block is full a new one is started with the newest items copied into it. As items
+         *          in a block are never modified once written, a snapshot of the history is just a reference to the
+         *          block and the range of items in it. This makes taking a snapshot constant time regardless of how
+         *          long the history is, while the cost of copying into a new block is amortised over the pushes.
+         *
+         *          The store is only active once something has requested a history for the type, until then pushing
+         *          data into it does nothing. Each PowerPlant keeps its own history.
+         *
+         * @tparam DataType the type of data stored in this history
+         */
+        template <typename DataType>
+        class HistoryStore {
+        public:
+            /**
+             * @brief A fixed size block of items that can only be appended to.
+             */
+            struct Block {
+                Block(size_t capacity) : items(new std::shared_ptr<const DataType>[capacity]), capacity(capacity) {}
+
+                /// @brief the items that are stored in this block
+                std::unique_ptr<std::shared_ptr<const DataType>[]> items;
+                /// @brief the number of items this block can hold
+                const size_t capacity;
+            };
+
+            /**
+             * @brief An immutable view of a range of items in a block.
+             */
+            struct Snapshot {
+                /// @brief the block that holds the items
+                std::shared_ptr<const Block> block;
+                /// @brief the index of the oldest item in the block that is part of this snapshot
+                size_t first;
+                /// @brief the index after the newest item in the block that is part of this snapshot
+                size_t last;
+            };
+
+        private:
+            /// @brief Deleted constructor as this class is a static class.
+            HistoryStore() = delete;
+            /// @brief Deleted destructor as this class is a static class.
+            ~HistoryStore() = delete;
+
+            /**
+             * @brief The history of this type in a single PowerPlant.
+             */
+            struct State {
+                /// @brief the block that new data is being appended to
+                std::shared_ptr<Block> block;
+                /// @brief the number of items that have been written into the current block
+                size_t count = 0;
+                /// @brief the number of items that must be kept in the history
+                std::atomic<size_t> length{0};
+                /// @brief a mutex to ensure data consistency
+                util::Mutex mutex{"HistoryStore", &util::lock_key<DataType>};
+            };
+
+            /// @brief the history for each PowerPlant
+            static std::array<State, util::max_powerplants> state;
+
+            /// @brief clears the history of a destroyed PowerPlant so the next to use its slot starts empty
+            static void reset(size_t plant) {
+                State& s = state[plant];
+                std::lock_guard<util::Mutex> lock(s.mutex);
+                s.block.reset();
+                s.count  = 0;
+                s.length = 0;
+            }
+
+        public:
+            /**
+             * @brief Ensures that at least n items of history are kept for this type
+             *
+             * @param plant the slot of the PowerPlant that needs the history
+             * @param n     the number of items of history that are required
+             */
+            static void reserve(size_t plant, size_t n) {
+
+                static const util::SlotReset registered(&HistoryStore::reset);
+
+                State& s = state[plant];
+                std::lock_guard<util::Mutex> lock(s.mutex);
+                if (n > s.length) { s.length = n; }
+            }
+
+            /**
+             * @brief Adds a new item to the history, dropping the oldest item if it is full.
+             *
+             * @param plant the slot of the PowerPlant the data was emitted in
+             * @param data  the data to add to the history
+             */
+            static void push(size_t plant, const std::shared_ptr<DataType>& data) {
+
+                State& s = state[plant];
+
+                // If nobody wants a history then we don't need to store anything
+                if (s.length.load(std::memory_order_relaxed) == 0) { return; }
+
+                std::lock_guard<util::Mutex> lock(s.mutex);
+
+                // If the block is full (or too small for the length) start a new block with the newest items
+                if (s.block == nullptr || s.count == s.block->capacity || s.block->capacity < s.length * 2) {
+                    auto next   = std::make_shared<Block>(s.length * 2);
+                    size_t kept = 0;
+                    if (s.block != nullptr) {
+                        kept = std::min(s.count, s.length - 1);
+                        std::copy(&s.block->items[s.count - kept], &s.block->items[s.count], &next->items[0]);
+                    }
+                    s.block = std::move(next);
+                    s.count = kept;
+                }
+
+                s.block->items[s.count++] = data;
+            }
+
+            /**
+             * @brief Gets a snapshot of the newest n items in the history.
+             *
+             * @param plant the slot of the PowerPlant to get the history from
+             * @param n     the maximum number of items to include in the snapshot
+             *
+             * @return a snapshot of up to n of the newest items in the history, oldest first
+             */
+            static Snapshot get(size_t plant, size_t n) {
+
+                State& s = state[plant];
+                std::lock_guard<util::Mutex> lock(s.mutex);
+                return Snapshot{s.block, s.count - std::min(s.count, n), s.count};
+            }
+        };
+
+        template <typename DataType>
+        std::array<typename HistoryStore<DataType>::State, util::max_powerplants> HistoryStore<DataType>::state;
+
+    }  // namespace store
+}  // namespace dsl
+}  // namespace NUClear
+
+#endif  // NUCLEAR_DSL_STORE_HISTORYSTORE_HPP
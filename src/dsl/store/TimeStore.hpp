@@ -0,0 +1,237 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NUCLEAR_DSL_STORE_TIMESTORE_HPP
+#define NUCLEAR_DSL_STORE_TIMESTORE_HPP
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <mutex>
+
+#include "../../util/Mutex.hpp"
+#include "../../util/powerplant_slots.hpp"
+#include "../trait/timestamp.hpp"
+#include "ThreadStore.hpp"
+
+namespace NUClear {
+namespace dsl {
+    namespace store {
+
+        /**
+         * @brief Stores a bounded amount of past data for a type, ordered by the time each piece of data represents.
+         *
+         * @details This store is used to look up data by time rather than by when it was emitted. For example, the
+         *          odometry that was closest to when an image was captured. The times are read using the timestamp
+         *          trait and the data is kept sorted by them, so lookups are a binary search. Once the store holds
+         *          more than the requested amount of data, the oldest data (by time) is dropped.
+         *
+         *          The store is only active once something has requested it for the type and the type has a
+         *          timestamp, until then pushing data into it does nothing. Each PowerPlant keeps its own data.
+         *
+         * @tparam DataType the type of data stored in this time index
+         */
+        template <typename DataType>
+        class TimeStore {
+        public:
+            using Item = std::pair<clock::time_point, std::shared_ptr<const DataType>>;
+
+        private:
+            /// @brief Deleted constructor as this class is a static class.
+            TimeStore() = delete;
+            /// @brief Deleted destructor as this class is a static class.
+            ~TimeStore() = delete;
+
+            /**
+             * @brief The data of this type in a single PowerPlant.
+             */
+            struct State {
+                /// @brief the stored data sorted by its time
+                std::deque<Item> items;
+                /// @brief the number of items that must be kept in the store
+                std::atomic<size_t> length{0};
+                /// @brief a mutex to ensure data consistency
+                util::Mutex mutex{"TimeStore", &util::lock_key<DataType>};
+            };
+
+            /// @brief the data for each PowerPlant
+            static std::array<State, util::max_powerplants> state;
+
+            /// @brief clears the data of a destroyed PowerPlant so the next to use its slot starts empty
+            static void reset(size_t plant) {
+                State& s = state[plant];
+                std::lock_guard<util::Mutex> lock(s.mutex);
+                s.items.clear();
+                s.length = 0;
+            }
+
+            static inline bool before(const Item& item, const clock::time_point& time) {
+                return item.first < time;
+            }
+
+        public:
+            /**
+             * @brief Ensures that at least n items are kept in this store
+             *
+             * @param plant the slot of the PowerPlant that needs the data
+             * @param n     the number of items that are required
+             */
+            static void reserve(size_t plant, size_t n) {
+
+                static const util::SlotReset registered(&TimeStore::reset);
+
+                State& s = state[plant];
+                std::lock_guard<util::Mutex> lock(s.mutex);
+                if (n > s.length) { s.length = n; }
+            }
+
+            /**
+             * @brief Adds new data into the store, dropping the oldest data if it is full.
+             *
+             * @param plant the slot of the PowerPlant the data was emitted in
+             * @param data  the data to add to the store
+             */
+            template <typename U = DataType>
+            static std::enable_if_t<trait::has_timestamp<U>::value> push(size_t plant,
+                                                                         const std::shared_ptr<DataType>& data) {
+
+                State& s = state[plant];
+
+                // If nobody wants to look up this type by time then we don't need to store anything
+                if (s.length.load(std::memory_order_relaxed) == 0 || data == nullptr) { return; }
+
+                Item item(trait::timestamp<U>::get(*data), data);
+
+                std::lock_guard<util::Mutex> lock(s.mutex);
+
+                // Data normally arrives in order so we can skip the search most of the time
+                if (s.items.empty() || !before(item, s.items.back().first)) { s.items.push_back(std::move(item)); }
+                else {
+                    s.items.insert(
+                        std::upper_bound(s.items.begin(),
+                                         s.items.end(),
+                                         item.first,
+                                         [](const clock::time_point& t, const Item& i) { return t < i.first; }),
+                        std::move(item));
+                }
+
+                while (s.items.size() > s.length) {
+                    s.items.pop_front();
+                }
+            }
+
+            /**
+             * @brief Types without a timestamp cannot be stored, so pushing them does nothing.
+             */
+            template <typename U = DataType>
+            static std::enable_if_t<!trait::has_timestamp<U>::value> push(size_t, const std::shared_ptr<DataType>&) {}
+
+            /**
+             * @brief Gets the time that the passed data represents, so reactions can look up other data against it.
+             *
+             * @param data    the data to get the time from
+             * @param storage where to store the time
+             *
+             * @return a pointer to storage, or nullptr if the data does not have a time
+             */
+            template <typename U = DataType>
+            static std::enable_if_t<trait::has_timestamp<U>::value, clock::time_point*> time(
+                const std::shared_ptr<DataType>& data,
+                clock::time_point& storage) {
+                if (data == nullptr) { return nullptr; }
+                storage = trait::timestamp<U>::get(*data);
+                return &storage;
+            }
+
+            template <typename U = DataType>
+            static std::enable_if_t<!trait::has_timestamp<U>::value, clock::time_point*> time(
+                const std::shared_ptr<DataType>&,
+                clock::time_point&) {
+                return nullptr;
+            }
+
+            /**
+             * @brief Gets the time that lookups should be made against.
+             *
+             * @details This is the time of the data that is currently being emitted if it has one, otherwise it is
+             *          the current time.
+             *
+             * @return the time to look up data against
+             */
+            static clock::time_point reference() {
+                return ThreadStore<clock::time_point>::value == nullptr ? clock::now()
+                                                                        : *ThreadStore<clock::time_point>::value;
+            }
+
+            /**
+             * @brief Gets the data whose time is closest to the passed time.
+             *
+             * @param plant the slot of the PowerPlant to look in
+             * @param time  the time to look up
+             *
+             * @return the closest data, or nullptr if the store is empty
+             */
+            static std::shared_ptr<const DataType> nearest(size_t plant, const clock::time_point& time) {
+
+                State& s = state[plant];
+                std::lock_guard<util::Mutex> lock(s.mutex);
+
+                if (s.items.empty()) { return nullptr; }
+
+                auto after = std::lower_bound(s.items.begin(), s.items.end(), time, before);
+                if (after == s.items.begin()) { return after->second; }
+                if (after == s.items.end()) { return s.items.back().second; }
+
+                auto prior = std::prev(after);
+                return (time - prior->first) <= (after->first - time) ? prior->second : after->second;
+            }
+
+            /**
+             * @brief Gets the data on either side of the passed time.
+             *
+             * @param plant the slot of the PowerPlant to look in
+             * @param time  the time to look up
+             *
+             * @return the newest item at or before the time and the oldest item at or after the time. If there is no
+             *         such item then its data will be nullptr
+             */
+            static std::pair<Item, Item> between(size_t plant, const clock::time_point& time) {
+
+                State& s = state[plant];
+                std::lock_guard<util::Mutex> lock(s.mutex);
+
+                auto after = std::lower_bound(s.items.begin(), s.items.end(), time, before);
+
+                // If we have an exact match it is on both sides
+                if (after != s.items.end() && after->first == time) { return std::make_pair(*after, *after); }
+
+                return std::make_pair(after == s.items.begin() ? Item() : *std::prev(after),
+                                      after == s.items.end() ? Item() : *after);
+            }
+        };
+
+        template <typename DataType>
+        std::array<typename TimeStore<DataType>::State, util::max_powerplants> TimeStore<DataType>::state;
+
+    }  // namespace store
+}  // namespace dsl
+}  // namespace NUClear
+
+#endif  // NUCLEAR_DSL_STORE_TIMESTORE_HPP
@@ -19,9 +19,12 @@
 #ifndef NUCLEAR_DSL_STORE_TYPECALLBACKSTORE_HPP
 #define NUCLEAR_DSL_STORE_TYPECALLBACKSTORE_HPP
 
+#include <array>
 #include <memory>
+#include <vector>
+
 #include "../../threading/Reaction.hpp"
-#include "../../util/TypeList.hpp"
+#include "../../util/powerplant_slots.hpp"
 
 namespace NUClear {
 namespace dsl {
@@ -35,11 +38,38 @@ namespace dsl {
          *          differnt type of message user in its own location the system knows exactly which reactions to
          *          execuing without having to do an expensive lookup. This reduces the latency and computational
          *          power invovled in spawning a new reaction when a type is emitted.
+         *          Each PowerPlant has its own list so that emitting in one PowerPlant never runs the reactions of
+         *          another.
          *
          * @tparam TriggeringType the type that when emitted will start this function
          */
         template <typename TriggeringType>
-        using TypeCallbackStore = util::TypeList<TriggeringType, TriggeringType, std::shared_ptr<threading::Reaction>>;
+        class TypeCallbackStore {
+        private:
+            /// @brief Deleted constructor as this class is a static class.
+            TypeCallbackStore() = delete;
+            /// @brief Deleted destructor as this class is a static class.
+            ~TypeCallbackStore() = delete;
+
+            /// @brief the reactions bound to this type in each PowerPlant
+            static std::array<std::vector<std::shared_ptr<threading::Reaction>>, util::max_powerplants> data;
+
+        public:
+            /**
+             * @brief Gets the list of reactions that are bound to this type in a PowerPlant
+             *
+             * @param plant the slot of the PowerPlant to get the reactions for
+             *
+             * @return A reference to the vector stored in this location
+             */
+            static std::vector<std::shared_ptr<threading::Reaction>>& get(size_t plant) {
+                return data[plant];
+            }
+        };
+
+        template <typename TriggeringType>
+        std::array<std::vector<std::shared_ptr<threading::Reaction>>, util::max_powerplants>
+            TypeCallbackStore<TriggeringType>::data;
 
     }  // namespace store
 }  // namespace dsl
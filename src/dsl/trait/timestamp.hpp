@@ -0,0 +1,71 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NUCLEAR_DSL_TRAIT_TIMESTAMP_HPP
+#define NUCLEAR_DSL_TRAIT_TIMESTAMP_HPP
+
+#include "../../clock.hpp"
+
+namespace NUClear {
+namespace dsl {
+    namespace trait {
+
+        /**
+         * @brief Provides the time that a piece of data represents (e.g. the capture time of an image)
+         *
+         * @details By default this uses a member called timestamp that can be converted to a clock::time_point.
+         *          If a type stores its time differently, this trait can be specialised to provide a get function
+         *          that returns the time for the data.
+         *
+         * @see NUClear::dsl::store::TimeStore
+         *
+         * @tparam DataType the datatype to get the time from
+         */
+        template <typename DataType>
+        struct timestamp {
+            template <typename U = DataType>
+            static inline auto get(const U& data) -> decltype(clock::time_point(data.timestamp)) {
+                return clock::time_point(data.timestamp);
+            }
+        };
+
+        /**
+         * @brief SFINAE struct to test if a type has a timestamp that can be accessed through the timestamp trait
+         *
+         * @tparam DataType the datatype to check
+         */
+        template <typename DataType>
+        struct has_timestamp {
+        private:
+            typedef std::true_type yes;
+            typedef std::false_type no;
+
+            template <typename U>
+            static auto test(int) -> decltype(timestamp<U>::get(std::declval<const U&>()), yes());
+            template <typename>
+            static no test(...);
+
+        public:
+            static constexpr bool value = std::is_same<decltype(test<DataType>(0)), yes>::value;
+        };
+
+    }  // namespace trait
+}  // namespace dsl
+}  // namespace NUClear
+
+#endif  // NUCLEAR_DSL_TRAIT_TIMESTAMP_HPP
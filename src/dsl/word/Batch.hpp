@@ -0,0 +1,149 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NUCLEAR_DSL_WORD_BATCH_HPP
+#define NUCLEAR_DSL_WORD_BATCH_HPP
+
+#include <mutex>
+#include <vector>
+
+#include "../../util/MergeTransient.hpp"
+#include "../../util/Mutex.hpp"
+#include "../Fusion.hpp"
+#include "../operation/TypeBind.hpp"
+#include "../store/ThreadStore.hpp"
+
+namespace NUClear {
+namespace dsl {
+    namespace word {
+
+        /**
+         * @brief Holds the messages that have been accumulated for a Batch or Window.
+         *
+         * @details Each emission provides one message, which is moved into the reaction's transient storage. Once
+         *          the batch is ready (n messages have accumulated, or for a Window the period is over) the whole
+         *          batch is moved out of the transient storage and given to the task.
+         *
+         * @tparam n the number of messages in a batch, or 0 to only release the batch when flushed
+         * @tparam T the type of the messages
+         */
+        template <size_t n, typename T>
+        struct BatchStorage {
+            // The messages we are storing
+            std::vector<std::shared_ptr<const T>> items;
+            // If this is a request to release the messages we have
+            bool flush;
+
+            BatchStorage() : items(), flush(false) {}
+
+            BatchStorage(std::shared_ptr<const T>&& data, bool release) : items(), flush(release) {
+                if (data) { items.push_back(std::move(data)); }
+            }
+
+            operator const std::vector<std::shared_ptr<const T>>&() const {
+                return items;
+            }
+
+            template <typename Output>
+            operator std::vector<Output>() const {
+                return std::vector<Output>(items.begin(), items.end());
+            }
+
+            operator bool() const {
+                return !items.empty();
+            }
+        };
+
+        /**
+         * @brief
+         *  This is used to deliver many messages of a type to a reaction in a single task.
+         *
+         * @details
+         *  @code on<Batch<n, T>>() @endcode
+         *  Each time T is emitted it is added to a batch for the subscribing reaction. Once n messages have
+         *  accumulated, a single task is created which is given all of them, oldest first, and a new batch is started.
+         *  No tasks are created for the emissions in between, and when the reaction is also triggered by another word
+         *  it still only runs once a batch is full.
+         *
+         *  This is useful for reactions such as logging and recording that process a large number of small messages,
+         *  where the cost of scheduling a task for each message would outweigh the work done on it.
+         *
+         *  The batch is provided as a vector.
+         *  @code .then([](const std::vector<std::shared_ptr<const T>>& batch) { ... }) @endcode
+         *
+         * @par Implements
+         *  Bind, Get
+         *
+         * @tparam n
+         *  the number of messages to deliver in each batch
+         * @tparam T
+         *  the datatype of the messages to batch
+         */
+        template <size_t n, typename T>
+        struct Batch : public Fusion<operation::TypeBind<T>> {
+
+            static_assert(n > 0, "A batch must contain at least one message");
+
+            template <typename DSL>
+            static inline BatchStorage<n, T> get(threading::Reaction&) {
+
+                // When another word triggered us there is no data, and the batch is left as it is until it is full
+                auto data = store::ThreadStore<std::shared_ptr<T>>::value;
+                return BatchStorage<n, T>(data == nullptr ? nullptr : std::shared_ptr<const T>(*data), false);
+            }
+        };
+
+    }  // namespace word
+
+    namespace trait {
+
+        template <size_t n, typename T>
+        struct is_transient<word::BatchStorage<n, T>> : public std::true_type {};
+
+    }  // namespace trait
+}  // namespace dsl
+
+namespace util {
+
+    template <size_t n, typename T>
+    struct MergeTransients<dsl::word::BatchStorage<n, T>> {
+        static inline bool merge(dsl::word::BatchStorage<n, T>& t, dsl::word::BatchStorage<n, T>& d) {
+
+            // Emissions can come from any thread so we must lock while changing the batch
+            std::lock_guard<util::Mutex> lock(mutex);
+
+            // Move our new message into the batch
+            t.items.insert(t.items.end(), d.items.begin(), d.items.end());
+            d.items.clear();
+
+            // If the batch is ready move it into the data, otherwise the data is left empty and no task will be made
+            if (d.flush || (n > 0 && t.items.size() >= n)) { d.items.swap(t.items); }
+
+            return true;
+        };
+
+        static util::Mutex mutex;
+    };
+
+    template <size_t n, typename T>
+    util::Mutex MergeTransients<dsl::word::BatchStorage<n, T>>::mutex("Batch", &util::lock_key<T>);
+
+}  // namespace util
+}  // namespace NUClear
+
+#endif  // NUCLEAR_DSL_WORD_BATCH_HPP
@@ -0,0 +1,127 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NUCLEAR_DSL_WORD_BETWEEN_HPP
+#define NUCLEAR_DSL_WORD_BETWEEN_HPP
+
+#include "../operation/CacheGet.hpp"
+#include "../store/TimeStore.hpp"
+
+namespace NUClear {
+namespace dsl {
+    namespace word {
+
+        /**
+         * @brief
+         *  This is used to provide a reaction with the data of a type on either side in time of the data that
+         *  triggered it, so that it can be interpolated.
+         *
+         * @details
+         *  @code on<Trigger<T1>, With<Between<T2>>>() @endcode
+         *  During system runtime, the PowerPlant will keep the last n emissions of T2 ordered by their timestamp. When
+         *  T1 is emitted into the system, the reaction will be provided with the newest T2 at or before the timestamp
+         *  of T1, and the oldest T2 at or after it. If there is a T2 with exactly the same time, it will be both.
+         *
+         *  The timestamps are read using NUClear::dsl::trait::timestamp, which by default uses a member called
+         *  timestamp. If the triggering data does not have a timestamp, the current time will be used instead.
+         *
+         *  The data is provided to the reaction as a Between object.
+         *  @code .then([](const Between<T2>& b) { ... b.before ... b.after ... b.fraction() }) @endcode
+         *
+         *  If there is no T2 on both sides of the time (the value would need to be extrapolated), the task will be
+         *  dropped. To override this functionality, include the DSL keyword "Optional" in the request.
+         *
+         * @par Implements
+         *  Bind, Get
+         *
+         * @tparam T
+         *  the datatype which will be provided to the reaction, it must have a timestamp.
+         * @tparam n
+         *  the number of emissions of T to keep to search through.
+         */
+        template <typename T, size_t n = 100>
+        struct Between {
+
+            static_assert(trait::has_timestamp<T>::value,
+                          "The type used with Between must have a timestamp, either as a member called timestamp or "
+                          "by specialising NUClear::dsl::trait::timestamp");
+
+            Between(const clock::time_point& time,
+                    std::pair<typename store::TimeStore<T>::Item, typename store::TimeStore<T>::Item>&& items)
+                : time(time)
+                , before_time(items.first.first)
+                , after_time(items.second.first)
+                , before(std::move(items.first.second))
+                , after(std::move(items.second.second)) {}
+
+            template <typename DSL>
+            static inline void bind(const std::shared_ptr<threading::Reaction>& reaction) {
+                store::TimeStore<T>::reserve(reaction->reactor.powerplant.id, n);
+            }
+
+            template <typename DSL>
+            static inline Between<T, n> get(threading::Reaction& r) {
+                auto time = store::TimeStore<T>::reference();
+                return Between<T, n>(time, store::TimeStore<T>::between(r.reactor.powerplant.id, time));
+            }
+
+            /**
+             * @brief Gets how far the time is from before to after, for use when interpolating
+             *
+             * @return 0 if the time is at before, 1 if it is at after
+             */
+            double fraction() const {
+                if (after_time == before_time) { return 0.0; }
+                return std::chrono::duration<double>(time - before_time).count()
+                       / std::chrono::duration<double>(after_time - before_time).count();
+            }
+
+            operator bool() const {
+                return before != nullptr && after != nullptr;
+            }
+
+            /// @brief the time that the data was looked up at
+            clock::time_point time;
+            /// @brief the time of the data before
+            clock::time_point before_time;
+            /// @brief the time of the data after
+            clock::time_point after_time;
+            /// @brief the newest data at or before the time
+            std::shared_ptr<const T> before;
+            /// @brief the oldest data at or after the time
+            std::shared_ptr<const T> after;
+        };
+
+    }  // namespace word
+
+    namespace operation {
+
+        /**
+         * @brief Allows Between to be used within a With statement
+         *
+         * @tparam T the datatype which will be provided to the reaction
+         * @tparam n the number of emissions of T to keep to search through
+         */
+        template <typename T, size_t n>
+        struct CacheGet<word::Between<T, n>> : public word::Between<T, n> {};
+
+    }  // namespace operation
+}  // namespace dsl
+}  // namespace NUClear
+
+#endif  // NUCLEAR_DSL_WORD_BETWEEN_HPP
@@ -0,0 +1,57 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NUCLEAR_DSL_WORD_CPUTIME_HPP
+#define NUCLEAR_DSL_WORD_CPUTIME_HPP
+
+#include "../../threading/Reaction.hpp"
+
+namespace NUClear {
+namespace dsl {
+    namespace word {
+
+        /**
+         * @brief
+         *  This is used to measure the CPU time and context switches of each task of a reaction.
+         *
+         * @details
+         *  @code on<Trigger<T>, CPUTime>() @endcode
+         *  The started and finished times in ReactionStatistics are wall clock times, so a task that was preempted or
+         *  that blocked waiting for something looks just as expensive as one that was busy the whole time. For
+         *  reactions that use this word, the statistics of each task also hold the CPU time the task used and the
+         *  number of voluntary (blocking) and involuntary (preempted) context switches it had.
+         *
+         *  Measuring costs two extra system calls at the start and end of each task, so this is only done for the
+         *  reactions that ask for it. Context switches are only counted on Linux.
+         *
+         * @par Implements
+         *  Bind
+         */
+        struct CPUTime {
+
+            template <typename DSL>
+            static inline void bind(const std::shared_ptr<threading::Reaction>& reaction) {
+                reaction->measure_cpu = true;
+            }
+        };
+
+    }  // namespace word
+}  // namespace dsl
+}  // namespace NUClear
+
+#endif  // NUCLEAR_DSL_WORD_CPUTIME_HPP
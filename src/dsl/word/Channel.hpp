@@ -0,0 +1,235 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NUCLEAR_DSL_WORD_CHANNEL_HPP
+#define NUCLEAR_DSL_WORD_CHANNEL_HPP
+
+#include <array>
+#include <atomic>
+#include <mutex>
+#include <stdexcept>
+
+#include "../../threading/Reaction.hpp"
+#include "../../util/Mutex.hpp"
+
+namespace NUClear {
+namespace dsl {
+    namespace word {
+
+        /**
+         * @brief
+         *  This is used to stream data from one producer to one consumer through a bounded lock free ring buffer.
+         *
+         * @details
+         *  @code on<Channel<T>>() @endcode
+         *  A Channel is a point to point alternative to emitting messages for high rate streams. The producer pushes
+         *  values directly into a fixed size ring buffer using Channel<T>::push. No shared_ptr is allocated, no lock is
+         *  taken, and no task is made for each value.
+         *
+         *  The consumer reaction is only scheduled when the channel goes from empty to non-empty. When its task runs
+         *  it is given the Channel itself, and it should drain every queued value using pop. Any values pushed while
+         *  the consumer is running will be picked up by the same task. If the callback leaves values in the channel,
+         *  another task will be scheduled once it returns.
+         *
+         *  @code
+         *  on<Channel<Sample>>().then([](const Channel<Sample>& channel) {
+         *      Sample s;
+         *      while (channel.pop(s)) { ... }
+         *  });
+         *  @endcode
+         *
+         * @attention
+         *  Each type of Channel is a single static ring buffer. It is only safe to have exactly one thread pushing into
+         *  it at a time, and only one reaction may be bound to consume from it. push returns false and discards
+         *  nothing if the channel is full; it is up to the producer to decide to retry or drop.
+         *
+         * @attention
+         *  Unlike the other stores, a Channel is shared by every PowerPlant in the process rather than kept for each
+         *  PowerPlant, as push has no way to know which PowerPlant it is pushing to. Binding the same Channel type in
+         *  a second PowerPlant throws. When several PowerPlants run the same reactors, each needs its own channel
+         *  type, for example by wrapping T in a different type for each of them.
+         *
+         * @par Implements
+         *  Bind, Get, Post-condition
+         *
+         * @tparam T the datatype that is carried by this channel. It must be default constructible and move assignable.
+         * @tparam n the number of values the channel can hold before push fails.
+         */
+        template <typename T, size_t n = 1024>
+        struct Channel {
+
+            /**
+             * @brief Push a value into the channel, scheduling the consumer if the channel was empty.
+             *
+             * @param value the value to push
+             *
+             * @return true if the value was added, false if the channel was full
+             */
+            static bool push(T&& value) {
+
+                const size_t t    = tail.load(std::memory_order_relaxed);
+                const size_t next = (t + 1) % (n + 1);
+
+                // One slot is always left empty so a full ring can be told apart from an empty one
+                if (next == head.load(std::memory_order_acquire)) { return false; }
+
+                ring[t] = std::move(value);
+                tail.store(next);
+
+                // Only the push that moves us out of the idle state pays for the wakeup
+                if (!scheduled.load() && !scheduled.exchange(true)) { wake(); }
+
+                return true;
+            }
+
+            /// @copydoc push(T&&)
+            static bool push(const T& value) {
+                return push(T(value));
+            }
+
+            /**
+             * @brief Take the oldest value out of the channel. Only the bound consumer may call this.
+             *
+             * @param value where to move the value to
+             *
+             * @return true if a value was taken, false if the channel was empty
+             */
+            bool pop(T& value) const {
+
+                const size_t h = head.load(std::memory_order_relaxed);
+                if (h == tail.load(std::memory_order_acquire)) { return false; }
+
+                value = std::move(ring[h]);
+                head.store((h + 1) % (n + 1), std::memory_order_release);
+                return true;
+            }
+
+            /// @brief the number of values that are waiting in the channel
+            static size_t size() {
+                const size_t h = head.load(std::memory_order_acquire);
+                const size_t t = tail.load(std::memory_order_acquire);
+                return (t + n + 1 - h) % (n + 1);
+            }
+
+            /// @brief a channel value always holds data, it is only given to the consumer when it was woken
+            operator bool() const {
+                return true;
+            }
+
+            template <typename DSL>
+            static inline void bind(const std::shared_ptr<threading::Reaction>& reaction) {
+
+                /* Mutex Scope */ {
+                    std::lock_guard<util::Mutex> lock(mutex);
+
+                    if (consumer) {
+                        throw std::runtime_error("This channel already has a consumer bound to it");
+                    }
+                    consumer = reaction;
+                }
+
+                reaction->unbinders.push_back([](threading::Reaction&) {
+                    std::lock_guard<util::Mutex> lock(mutex);
+                    consumer.reset();
+                });
+
+                // Anything pushed before we existed would not have woken anyone
+                recheck();
+            }
+
+            template <typename DSL>
+            static inline Channel<T, n> get(threading::Reaction&) {
+                return Channel<T, n>();
+            }
+
+            template <typename DSL>
+            static inline void postcondition(threading::ReactionTask&) {
+                recheck();
+            }
+
+        private:
+            /// @brief go idle, unless a value arrived that the producer expected us to see
+            static void recheck() {
+
+                // These are sequentially consistent with the tail store and scheduled load in push so that either we
+                // see the new value here, or the producer sees that we are idle and wakes us itself
+                scheduled.store(false);
+                if (tail.load() != head.load(std::memory_order_relaxed) && !scheduled.exchange(true)) { wake(); }
+            }
+
+            /// @brief submit a task for the consumer reaction, or go back to idle if one can't be made
+            static void wake() {
+
+                // The consumer may have drained the value we were woken for between the producer's tail store and its
+                // scheduled load, so only go ahead if there is still something to drain
+                if (size() == 0) {
+                    scheduled.store(false);
+                    if (size() == 0 || scheduled.exchange(true)) { return; }
+                }
+
+                std::shared_ptr<threading::Reaction> reaction;
+                /* Mutex Scope */ {
+                    std::lock_guard<util::Mutex> lock(mutex);
+                    reaction = consumer;
+                }
+
+                auto task = reaction ? reaction->get_task() : std::unique_ptr<threading::ReactionTask>(nullptr);
+                if (task) { reaction->reactor.powerplant.submit(std::move(task)); }
+                else {
+                    // Nothing will drain the channel so the next push must wake it again
+                    scheduled.store(false);
+                }
+            }
+
+            /// @brief the values in the channel
+            static std::array<T, n + 1> ring;
+            /// @brief the index of the next value to pop, only written by the consumer
+            alignas(64) static std::atomic<size_t> head;
+            /// @brief the index of the next slot to push into, only written by the producer
+            alignas(64) static std::atomic<size_t> tail;
+            /// @brief true while a consumer task is queued or running
+            alignas(64) static std::atomic<bool> scheduled;
+            /// @brief the reaction that drains this channel
+            static std::shared_ptr<threading::Reaction> consumer;
+            /// @brief a mutex protecting the consumer, only taken on binding and wakeup
+            static util::Mutex mutex;
+        };
+
+        template <typename T, size_t n>
+        std::array<T, n + 1> Channel<T, n>::ring;
+
+        template <typename T, size_t n>
+        alignas(64) std::atomic<size_t> Channel<T, n>::head(0);
+
+        template <typename T, size_t n>
+        alignas(64) std::atomic<size_t> Channel<T, n>::tail(0);
+
+        template <typename T, size_t n>
+        alignas(64) std::atomic<bool> Channel<T, n>::scheduled(false);
+
+        template <typename T, size_t n>
+        std::shared_ptr<threading::Reaction> Channel<T, n>::consumer;
+
+        template <typename T, size_t n>
+        util::Mutex Channel<T, n>::mutex("Channel", &util::lock_key<T>);
+
+    }  // namespace word
+}  // namespace dsl
+}  // namespace NUClear
+
+#endif  // NUCLEAR_DSL_WORD_CHANNEL_HPP
@@ -0,0 +1,168 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NUCLEAR_DSL_WORD_DEBOUNCE_HPP
+#define NUCLEAR_DSL_WORD_DEBOUNCE_HPP
+
+#include <map>
+#include <mutex>
+
+#include "../../util/Mutex.hpp"
+#include "../operation/ChronoTask.hpp"
+#include "../operation/Unbind.hpp"
+#include "emit/Direct.hpp"
+#include "emit/Local.hpp"
+
+namespace NUClear {
+namespace dsl {
+    namespace word {
+
+        /**
+         * @brief
+         *  This is used to run a reaction once after its triggers have stopped for a period.
+         *
+         * @details
+         *  @code on<Trigger<T>, Debounce<ticks, period>>() @endcode
+         *  Triggering the subscribing reaction will not create a task straight away. Instead, once the reaction has
+         *  not been triggered for the given period, it will run once with the latest data.
+         *
+         *  This is useful for reactions that should only act once a burst of data has settled, such as saving a
+         *  configuration after a user has finished changing it.
+         *
+         * @attention
+         *  If the reaction is triggered continuously with gaps shorter than the period it will never run. If it should
+         *  still run regularly in that case, use Throttle instead.
+         *
+         * @par Implements
+         *  Bind, Precondition
+         *
+         * @tparam ticks
+         *  the number of ticks of a particular type that the triggers must stop for
+         * @tparam period
+         *  a type of duration (e.g. std::chrono::seconds) to measure the ticks in
+         */
+        template <int ticks, class period = NUClear::clock::duration>
+        struct Debounce {
+        private:
+            /**
+             * @brief Holds the debouncing state for a reaction
+             */
+            struct State {
+                /// @brief the reaction this state is for, so it can be run once the triggers stop
+                std::weak_ptr<threading::Reaction> reaction;
+                /// @brief the time the reaction was last triggered
+                NUClear::clock::time_point last;
+                /// @brief if a run has been scheduled for when the triggers stop
+                bool scheduled = false;
+            };
+
+            /// @brief the state for each of the reactions that use this word, indexed by reaction id
+            static std::map<uint64_t, State> states;
+            /// @brief a mutex to ensure data consistency
+            static util::Mutex mutex;
+            /// @brief set while this thread is running the reaction so that the precondition lets it through
+            static thread_local bool running;
+
+            static bool run(uint64_t id, NUClear::clock::time_point& time) {
+
+                std::shared_ptr<threading::Reaction> reaction;
+                /* Mutex Scope */ {
+                    std::lock_guard<util::Mutex> lock(mutex);
+                    auto it = states.find(id);
+
+                    // If the reaction was unbound there is nothing to run
+                    if (it == states.end()) { return false; }
+
+                    // We were triggered again since this was scheduled, so wait until a period after that
+                    if (NUClear::clock::now() < it->second.last + period(ticks)) {
+                        time = it->second.last + period(ticks);
+                        return true;
+                    }
+
+                    it->second.scheduled = false;
+                    reaction             = it->second.reaction.lock();
+                }
+
+                if (reaction) {
+                    running   = true;
+                    auto task = reaction->get_task();
+                    running   = false;
+                    if (task) { reaction->reactor.powerplant.submit(std::move(task)); }
+                }
+
+                return false;
+            }
+
+        public:
+            template <typename DSL>
+            static inline void bind(const std::shared_ptr<threading::Reaction>& reaction) {
+
+                /* Mutex Scope */ {
+                    std::lock_guard<util::Mutex> lock(mutex);
+                    states[reaction->id].reaction = reaction;
+                }
+
+                reaction->unbinders.push_back([](const threading::Reaction& r) {
+                    /* Mutex Scope */ {
+                        std::lock_guard<util::Mutex> lock(mutex);
+                        states.erase(r.id);
+                    }
+                    r.reactor.emit<emit::Direct>(std::make_unique<operation::Unbind<operation::ChronoTask>>(r.id));
+                });
+            }
+
+            template <typename DSL>
+            static inline bool precondition(threading::Reaction& r) {
+
+                // The triggers have stopped and we are running the reaction
+                if (running) { return true; }
+
+                auto now = NUClear::clock::now();
+
+                /* Mutex Scope */ {
+                    std::lock_guard<util::Mutex> lock(mutex);
+                    auto& state = states[r.id];
+                    state.last  = now;
+
+                    if (state.scheduled) { return false; }
+                    state.scheduled = true;
+                }
+
+                // This is emitted locally as we may be running from inside the chrono controller
+                uint64_t id = r.id;
+                r.reactor.emit<emit::Local>(std::make_unique<operation::ChronoTask>(
+                    [id](NUClear::clock::time_point& time) { return run(id, time); }, now + period(ticks), id));
+
+                return false;
+            }
+        };
+
+        template <int ticks, class period>
+        std::map<uint64_t, typename Debounce<ticks, period>::State> Debounce<ticks, period>::states;
+
+        template <int ticks, class period>
+        util::Mutex Debounce<ticks, period>::mutex("Debounce");
+
+        template <int ticks, class period>
+        thread_local bool Debounce<ticks, period>::running = false;
+
+    }  // namespace word
+}  // namespace dsl
+}  // namespace NUClear
+
+#endif  // NUCLEAR_DSL_WORD_DEBOUNCE_HPP
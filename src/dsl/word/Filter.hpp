@@ -0,0 +1,68 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NUCLEAR_DSL_WORD_FILTER_HPP
+#define NUCLEAR_DSL_WORD_FILTER_HPP
+
+#include "../../util/apply.hpp"
+
+namespace NUClear {
+namespace dsl {
+    namespace word {
+
+        /**
+         * @brief
+         *  This is used to only run a reaction when its data passes a test.
+         *
+         * @details
+         *  @code on<Trigger<T>, Filter<Predicate>>() @endcode
+         *  When the subscribing reaction is triggered, the Predicate is called with the data that the reaction would
+         *  run with. If it returns false the task is dropped before it is created, so it never uses a thread, enters
+         *  the scheduler or emits statistics.
+         *
+         *  The predicate is a default constructible type with a call operator. As with the reaction's callback, it
+         *  only needs to list the arguments that it is interested in.
+         *  @code
+         *  struct IsRelevant {
+         *      bool operator()(const T& t) const { return t.relevant(); }
+         *  };
+         *  @endcode
+         *
+         *  As the predicate runs in the thread that triggered the reaction, it should be quick to run. If more than
+         *  one Filter is used, all of them must pass for the reaction to run.
+         *
+         * @par Implements
+         *  Filter
+         *
+         * @tparam Predicate
+         *  the type which is used to test the data.
+         */
+        template <typename Predicate>
+        struct Filter {
+
+            template <typename DSL, typename Data>
+            static inline bool filter(threading::Reaction&, const Data& data) {
+                return util::apply_relevant(Predicate(), std::move(data));
+            }
+        };
+
+    }  // namespace word
+}  // namespace dsl
+}  // namespace NUClear
+
+#endif  // NUCLEAR_DSL_WORD_FILTER_HPP
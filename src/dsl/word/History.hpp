@@ -0,0 +1,153 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NUCLEAR_DSL_WORD_HISTORY_HPP
+#define NUCLEAR_DSL_WORD_HISTORY_HPP
+
+#include <list>
+#include <vector>
+
+#include "../operation/CacheGet.hpp"
+#include "../store/HistoryStore.hpp"
+
+namespace NUClear {
+namespace dsl {
+    namespace word {
+
+        /**
+         * @brief
+         *  This is used to provide a reaction with read-only access to the last n emissions of a type.
+         *
+         * @details
+         *  @code on<Trigger<T1>, With<History<n, T2>>>() @endcode
+         *  During system runtime, the PowerPlant will keep a record of the last n emissions of T2. When the reaction
+         *  is triggered it will be given an immutable snapshot of up to n of these emissions. The snapshot is ordered
+         *  such that the oldest element is first, and the newest element is last.
+         *
+         *  Unlike Last, which copies the stored list into every task, the history is shared between all reactions that
+         *  use it and taking a snapshot costs the same regardless of n. This makes it suited to long histories of high
+         *  rate data.
+         *
+         *  @code on<Trigger<T>, History<n, T>>() @endcode
+         *  This word can also be used on its own alongside a trigger. When the history is of the triggering type, the
+         *  newest element of the snapshot will be the data that triggered the reaction.
+         *
+         *  The snapshot is provided to the reaction as a History object, which can be iterated over or converted to a
+         *  std::vector or std::list of std::shared_ptr<const T>.
+         *  @code .then([](const History<n, T>& history) { ... }) @endcode
+         *
+         *  If no data of the type has been emitted yet, the task will be dropped. To override this functionality,
+         *  include the DSL keyword "Optional" in the request.
+         *
+         * @par Implements
+         *  Bind, Get
+         *
+         * @tparam n
+         *  the number of records to be provided to the reaction.
+         * @tparam T
+         *  the datatype that the history is kept for.
+         */
+        template <size_t n, typename T>
+        struct History {
+
+            using const_iterator = const std::shared_ptr<const T>*;
+
+            History(typename store::HistoryStore<T>::Snapshot&& snapshot) : snapshot(std::move(snapshot)) {}
+
+            template <typename DSL>
+            static inline void bind(const std::shared_ptr<threading::Reaction>& reaction) {
+                store::HistoryStore<T>::reserve(reaction->reactor.powerplant.id, n);
+            }
+
+            template <typename DSL>
+            static inline History<n, T> get(threading::Reaction& r) {
+                return History<n, T>(store::HistoryStore<T>::get(r.reactor.powerplant.id, n));
+            }
+
+            /// @brief returns the number of elements in this history
+            size_t size() const {
+                return snapshot.last - snapshot.first;
+            }
+
+            /// @brief returns true if there are no elements in this history
+            bool empty() const {
+                return size() == 0;
+            }
+
+            /// @brief returns an iterator to the oldest element in this history
+            const_iterator begin() const {
+                return empty() ? nullptr : &snapshot.block->items[snapshot.first];
+            }
+
+            /// @brief returns an iterator past the newest element in this history
+            const_iterator end() const {
+                return empty() ? nullptr : &snapshot.block->items[snapshot.last];
+            }
+
+            /// @brief returns the element at position i where 0 is the oldest element
+            const std::shared_ptr<const T>& operator[](size_t i) const {
+                return snapshot.block->items[snapshot.first + i];
+            }
+
+            /// @brief returns the oldest element in this history
+            const std::shared_ptr<const T>& front() const {
+                return (*this)[0];
+            }
+
+            /// @brief returns the newest element in this history
+            const std::shared_ptr<const T>& back() const {
+                return (*this)[size() - 1];
+            }
+
+            template <typename Output>
+            operator std::list<Output>() const {
+                return std::list<Output>(begin(), end());
+            }
+
+            template <typename Output>
+            operator std::vector<Output>() const {
+                return std::vector<Output>(begin(), end());
+            }
+
+            operator bool() const {
+                return !empty();
+            }
+
+        private:
+            /// @brief the snapshot of the history that this object provides access to
+            typename store::HistoryStore<T>::Snapshot snapshot;
+        };
+
+    }  // namespace word
+
+    namespace operation {
+
+        /**
+         * @brief Allows a History to be used within a With statement
+         *
+         * @tparam n the number of records to be provided to the reaction
+         * @tparam T the datatype that the history is kept for
+         */
+        template <size_t n, typename T>
+        struct CacheGet<word::History<n, T>> : public word::History<n, T> {};
+
+    }  // namespace operation
+}  // namespace dsl
+}  // namespace NUClear
+
+#endif  // NUCLEAR_DSL_WORD_HISTORY_HPP
@@ -0,0 +1,157 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NUCLEAR_DSL_WORD_IPC_HPP
+#define NUCLEAR_DSL_WORD_IPC_HPP
+
+#include <functional>
+
+#include "../../util/serialise/Serialise.hpp"
+#include "../store/ThreadStore.hpp"
+#include "../trait/is_transient.hpp"
+
+namespace NUClear {
+namespace dsl {
+    namespace word {
+
+        template <typename T>
+        struct IPCData : public std::shared_ptr<T> {
+            IPCData() : std::shared_ptr<T>() {}
+            IPCData(T* ptr) : std::shared_ptr<T>(ptr) {}
+            IPCData(const std::shared_ptr<T>& ptr) : std::shared_ptr<T>(ptr) {}
+            IPCData(std::shared_ptr<T>&& ptr) : std::shared_ptr<T>(ptr) {}
+        };
+
+        struct IPCSource {
+            IPCSource() : pid(0) {}
+
+            /// The process id of the process that emitted the message
+            int32_t pid;
+        };
+
+        struct IPCMessage {
+            IPCMessage() : data() {}
+
+            /// The message after it has been deserialised, shared by every reaction that it triggers
+            std::shared_ptr<void> data;
+        };
+
+        struct IPCListen {
+            IPCListen() : hash(), reaction(), deserialise() {}
+
+            uint64_t hash;
+            std::shared_ptr<threading::Reaction> reaction;
+            /// Deserialises a message of this type straight out of shared memory
+            std::function<std::shared_ptr<void>(const char*, size_t)> deserialise;
+        };
+
+        /**
+         * @brief
+         *  NUClear provides a shared memory transport to send messages to other processes on the same host.
+         *
+         * @details
+         *  @code on<IPC<T>>() @endcode
+         *  This request can be used to split a NUClear system into several processes on one machine without paying
+         *  for the network stack. Messages are written straight into a shared memory ring for their type, and
+         *  processes that are listening are woken through the IOController when new messages arrive. Each message
+         *  is deserialised once straight out of shared memory, and every reaction for it shares the result.
+         *
+         *  When the reaction is triggered, read-only access to T will be provided to the triggering unit via a
+         *  callback. Messages emitted by this process are received as well as those from other processes, an
+         *  IPCSource can be requested in the callback to tell them apart.
+         *
+         * @attention
+         *  When using an on<IPC<T>> request, the associated reaction will only be triggered when T is emitted to the
+         *  system using the emission Scope::IPC. Should T be emitted to the system under any other scope, this
+         *  reaction will not be triggered.
+         *
+         * @attention
+         *  Like UDP, a process that falls too far behind will miss messages rather than slowing down the processes
+         *  that are emitting them.
+         *
+         * @attention
+         *  A message can be at most 8 MiB once serialised. Larger messages are not sent, and an error is logged.
+         *
+         * @attention
+         *  The shared memory segment for each type is removed when the last process using it closes it. A process
+         *  that crashes leaves its segments behind in /dev/shm (named nuclear_ipc followed by the layout version and
+         *  the type hash), and they can be deleted by hand once no process is using them.
+         *
+         * @par Implements
+         *  Bind, Get
+         *
+         * @tparam T
+         *  the datatype on which the reaction callback will be triggered. It must be serialisable with
+         *  util::serialise::Serialise.
+         */
+        template <typename T>
+        struct IPC {
+
+            template <typename DSL>
+            static inline void bind(const std::shared_ptr<threading::Reaction>& reaction) {
+
+                auto task = std::make_unique<IPCListen>();
+
+                task->hash        = util::serialise::Serialise<T>::hash();
+                task->deserialise = [](const char* data, size_t size) -> std::shared_ptr<void> {
+                    return std::make_shared<T>(util::serialise::Serialise<T>::deserialise(data, size));
+                };
+                reaction->unbinders.push_back([](const threading::Reaction& r) {
+                    r.reactor.emit<emit::Direct>(std::make_unique<operation::Unbind<IPCListen>>(r.id));
+                });
+
+                task->reaction = reaction;
+
+                reaction->reactor.emit<emit::Direct>(task);
+            }
+
+            template <typename DSL>
+            static inline std::tuple<std::shared_ptr<IPCSource>, IPCData<T>> get(threading::Reaction&) {
+
+                auto message = store::ThreadStore<IPCMessage>::value;
+                auto source  = store::ThreadStore<IPCSource>::value;
+
+                if (message && source) {
+
+                    // Return the data that was deserialised for every reaction
+                    return std::make_tuple(std::make_shared<IPCSource>(*source),
+                                           IPCData<T>(std::static_pointer_cast<T>(message->data)));
+                }
+                else {
+
+                    // Return invalid data
+                    return std::make_tuple(std::shared_ptr<IPCSource>(nullptr), IPCData<T>(nullptr));
+                }
+            }
+        };
+
+    }  // namespace word
+
+    namespace trait {
+
+        template <typename T>
+        struct is_transient<typename word::IPCData<T>> : public std::true_type {};
+
+        template <>
+        struct is_transient<typename std::shared_ptr<word::IPCSource>> : public std::true_type {};
+
+    }  // namespace trait
+}  // namespace dsl
+}  // namespace NUClear
+
+#endif  // NUCLEAR_DSL_WORD_IPC_HPP
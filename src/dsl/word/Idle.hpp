@@ -0,0 +1,64 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NUCLEAR_DSL_WORD_IDLE_HPP
+#define NUCLEAR_DSL_WORD_IDLE_HPP
+
+namespace NUClear {
+namespace dsl {
+    namespace word {
+
+        /**
+         * @brief
+         *  This is used to request reactions that only run when the thread pool has nothing else to do.
+         *
+         * @details
+         *  @code on<Idle>() @endcode
+         *  Tasks for this reaction are never queued. Instead, whenever a pool thread finds that there are no other
+         *  tasks waiting, rather than going to sleep it will run a task for this reaction. Once that task finishes,
+         *  the thread will check the queue again before running any more idle work, so normal tasks are never kept
+         *  waiting by more than one idle task.
+         *
+         *  This is useful for maintenance work (such as compacting caches) that should only use spare CPU. Unlike
+         *  Priority::IDLE, which only orders a task against the other queued tasks, an Idle reaction never takes a
+         *  thread while there is other work to do.
+         *
+         *  The number of pool threads that can run Idle reactions at the same time is limited by the idle_thread_count
+         *  of the PowerPlant's configuration. As with Always, the reaction will keep running for as long as the pool
+         *  is idle, so each task should do a small amount of work.
+         *
+         * @par Implements
+         *  Bind
+         */
+        struct Idle {
+
+            template <typename DSL>
+            static inline void bind(const std::shared_ptr<threading::Reaction>& reaction) {
+
+                reaction->unbinders.push_back(
+                    [](threading::Reaction& r) { r.reactor.powerplant.remove_idle_task(r.id); });
+
+                reaction->reactor.powerplant.add_idle_task(reaction);
+            }
+        };
+
+    }  // namespace word
+}  // namespace dsl
+}  // namespace NUClear
+
+#endif  // NUCLEAR_DSL_WORD_IDLE_HPP
@@ -0,0 +1,105 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NUCLEAR_DSL_WORD_INLINE_HPP
+#define NUCLEAR_DSL_WORD_INLINE_HPP
+
+#include "../../threading/Reaction.hpp"
+
+namespace NUClear {
+namespace dsl {
+    namespace word {
+
+        /**
+         * @brief
+         *  This is used to run cheap reactions on the thread that emitted their data, rather than through the thread
+         *  pool.
+         *
+         * @details
+         *  @code on<Trigger<T>, Inline>() @endcode
+         *  When T is emitted locally, the task for this reaction will be run straight away by the emitting thread
+         *  instead of being queued. The tasks for any other reactions to T are still queued as normal. This avoids
+         *  the cost of queuing a task and waking a thread, which for very small reactions can be more than the cost
+         *  of running them.
+         *
+         *  Unlike emit<Direct>, which runs every reaction inline, this only affects reactions that ask for it.
+         *
+         * @par Safety limits
+         *  An inline task is run in the middle of the emitting reaction, so to keep this from blocking it the task is
+         *  queued as normal if inline tasks are already nested too deeply on this thread (such as an inline reaction
+         *  that emits data for another inline reaction), or if the reaction's tasks have been taking too long to run.
+         *
+         * @par Implements
+         *  Bind
+         */
+        struct Inline {
+
+            /// @brief how deeply inline tasks can be nested on a thread before new tasks are queued instead
+            static constexpr int max_depth = 8;
+
+            /// @brief tasks for a reaction are queued instead if its average inline runtime is longer than this (100us)
+            static constexpr clock::rep max_runtime =
+                std::chrono::duration_cast<clock::duration>(std::chrono::microseconds(100)).count();
+
+            template <typename DSL>
+            static inline void bind(const std::shared_ptr<threading::Reaction>& reaction) {
+                reaction->run_inline = true;
+            }
+
+            /**
+             * @brief Runs the task on the current thread if it is from an Inline reaction and it is safe to do so.
+             *
+             * @param task the task to run, it will be moved from if it is run
+             *
+             * @return true if the task was run, false if it should be queued instead
+             */
+            static inline bool run(std::unique_ptr<threading::ReactionTask>& task) {
+
+                static thread_local int depth = 0;
+
+                auto& reaction = task->parent;
+                if (!reaction.run_inline || depth >= max_depth) { return false; }
+
+                // If we have been too slow, queue this task but decay our average so we will try again later
+                auto average = reaction.inline_runtime.load(std::memory_order_relaxed);
+                if (average > max_runtime) {
+                    reaction.inline_runtime.store(average - average / 8, std::memory_order_relaxed);
+                    return false;
+                }
+
+                ++depth;
+                auto start = clock::now();
+                task       = task->run(std::move(task));
+                auto end   = clock::now();
+                --depth;
+
+                // Update our average runtime (if the task was rescheduled it didn't run here)
+                if (task) {
+                    reaction.inline_runtime.store(average - average / 8 + (end - start).count() / 8,
+                                                  std::memory_order_relaxed);
+                }
+
+                return true;
+            }
+        };
+
+    }  // namespace word
+}  // namespace dsl
+}  // namespace NUClear
+
+#endif  // NUCLEAR_DSL_WORD_INLINE_HPP
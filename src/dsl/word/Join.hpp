@@ -0,0 +1,206 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NUCLEAR_DSL_WORD_JOIN_HPP
+#define NUCLEAR_DSL_WORD_JOIN_HPP
+
+#include <algorithm>
+#include <map>
+#include <mutex>
+
+#include "../../clock.hpp"
+#include "../../util/MetaProgramming.hpp"
+#include "../../util/Mutex.hpp"
+#include "../../util/Sequence.hpp"
+#include "../Fusion.hpp"
+#include "../operation/CacheGet.hpp"
+#include "../operation/TypeBind.hpp"
+#include "../trait/timestamp.hpp"
+
+namespace NUClear {
+namespace dsl {
+    namespace word {
+
+        /**
+         * @brief
+         *  This is used to request a reaction that only runs when every one of its inputs has new data.
+         *
+         * @details
+         *  @code on<Join<T1, T2, ... >>() @endcode
+         *  Like Trigger, this will be triggered whenever any of the listed types is emitted into the system. However,
+         *  a task will only be created once <b>every</b> type has been emitted since the last task was created for
+         *  this reaction. This way a reaction that needs matching sets of data (such as a left and right camera
+         *  image) does not run on every half-update with a stale copy of the other data.
+         *
+         *  If a type is emitted more than once before the others arrive, the reaction will be given the most recent
+         *  emission of each type.
+         *
+         *  @code on<Join<T1, T2>, With<T3>, Filter<F>>() @endcode
+         *  The data is only consumed once a task has been made with it. If another word stops the task from being
+         *  made (such as With having no data, Filter rejecting it, or Single) the same set of data can still make a
+         *  task when the reaction is next triggered.
+         *
+         *  To only run with data that was captured at around the same time, use JoinWithin.
+         *
+         * @par Implements
+         *  Bind, Get, Commit
+         *
+         * @tparam Ts
+         *  The datatypes that must all be emitted before the subscribing reaction will run.
+         */
+        template <typename... Ts>
+        struct Join : public Fusion<operation::TypeBind<Ts>...> {
+        protected:
+            using Words = Fusion<operation::TypeBind<Ts>...>;
+            using Data  = std::tuple<std::shared_ptr<const Ts>...>;
+
+            /// @brief the data that each reaction last ran with, indexed by reaction id
+            static std::map<uint64_t, Data> consumed;
+            /// @brief a mutex to ensure data consistency
+            static util::Mutex mutex;
+            /// @brief the reaction that get last offered fresh data for on this thread
+            static thread_local uint64_t offered_to;
+            /// @brief the fresh data that get last offered on this thread, which commit consumes
+            static thread_local Data offered;
+
+            template <int... Index>
+            static inline bool fresh(const Data& data, const Data& last, util::Sequence<Index...>) {
+                for (bool v :
+                     {true, (std::get<Index>(data) != nullptr && std::get<Index>(data) != std::get<Index>(last))...}) {
+                    if (!v) { return false; }
+                }
+                return true;
+            }
+
+        public:
+            template <typename DSL>
+            static inline void bind(const std::shared_ptr<threading::Reaction>& reaction) {
+
+                // Forget what this reaction has seen when it is unbound
+                reaction->unbinders.push_back([](threading::Reaction& r) {
+                    std::lock_guard<util::Mutex> lock(mutex);
+                    consumed.erase(r.id);
+                });
+
+                Words::template bind<DSL>(reaction);
+            }
+
+            template <typename DSL>
+            static inline Data get(threading::Reaction& r) {
+
+                Data data(operation::CacheGet<Ts>::template get<DSL>(r)...);
+
+                std::lock_guard<util::Mutex> lock(mutex);
+
+                // Only make a task if all of our data is new, otherwise return nothing so no task is created
+                if (fresh(data, consumed[r.id], util::GenerateSequence<0, sizeof...(Ts)>())) {
+                    offered_to = r.id;
+                    offered    = data;
+                    return data;
+                }
+                offered_to = 0;
+                offered    = Data();
+                return Data();
+            }
+
+            template <typename DSL>
+            static inline bool commit(threading::Reaction& r) {
+
+                // Another reaction may have been offered data since our get, if so we no longer know what we offered
+                if (offered_to != r.id) { return false; }
+                Data data = std::move(offered);
+
+                std::lock_guard<util::Mutex> lock(mutex);
+                auto& last = consumed[r.id];
+
+                // Another thread may have made a task with this data since our get
+                if (!fresh(data, last, util::GenerateSequence<0, sizeof...(Ts)>())) { return false; }
+                last = data;
+                return true;
+            }
+        };
+
+        /**
+         * @brief
+         *  This is used to request a reaction that only runs when every one of its inputs has new data, and that data
+         *  was all captured within a tolerance of each other.
+         *
+         * @details
+         *  @code on<JoinWithin<ticks, period, T1, T2, ... >>() @endcode
+         *  This works like Join, but the most recent emission of each type must also have timestamps (as given by
+         *  dsl::trait::timestamp) that are no more than ticks of period apart. If they are not, no task is created and
+         *  the data is kept until newer data arrives that does match. This way a left and right camera image are only
+         *  paired when they were taken together, even if one camera drops a frame.
+         *
+         * @par Implements
+         *  Bind, Get, Commit
+         *
+         * @tparam ticks
+         *  the number of ticks of period that the timestamps may be apart
+         * @tparam period
+         *  a type of duration (e.g. std::chrono::milliseconds) to measure the ticks in
+         * @tparam Ts
+         *  The datatypes that must all be emitted before the subscribing reaction will run. Each must have a timestamp.
+         */
+        template <int ticks, class period, typename... Ts>
+        struct JoinWithin : public Join<Ts...> {
+        private:
+            using Data = typename Join<Ts...>::Data;
+
+            static_assert(All<trait::has_timestamp<Ts>...>::value, "Every type in a JoinWithin must have a timestamp");
+
+            template <int... Index>
+            static inline bool within(const Data& data, util::Sequence<Index...>) {
+                const clock::time_point times[] = {trait::timestamp<Ts>::get(*std::get<Index>(data))...};
+                auto range = std::minmax_element(std::begin(times), std::end(times));
+                return *range.second - *range.first <= period(ticks);
+            }
+
+        public:
+            template <typename DSL>
+            static inline Data get(threading::Reaction& r) {
+
+                Data data = Join<Ts...>::template get<DSL>(r);
+
+                // Our data is only offered if it is all fresh, in which case it must also match in time
+                if (Join<Ts...>::offered_to == r.id && !within(data, util::GenerateSequence<0, sizeof...(Ts)>())) {
+                    Join<Ts...>::offered_to = 0;
+                    Join<Ts...>::offered    = Data();
+                    return Data();
+                }
+                return data;
+            }
+        };
+
+        template <typename... Ts>
+        std::map<uint64_t, typename Join<Ts...>::Data> Join<Ts...>::consumed;
+
+        template <typename... Ts>
+        util::Mutex Join<Ts...>::mutex("Join", &util::lock_key<Ts...>);
+
+        template <typename... Ts>
+        thread_local uint64_t Join<Ts...>::offered_to = 0;
+
+        template <typename... Ts>
+        thread_local typename Join<Ts...>::Data Join<Ts...>::offered;
+
+    }  // namespace word
+}  // namespace dsl
+}  // namespace NUClear
+
+#endif  // NUCLEAR_DSL_WORD_JOIN_HPP
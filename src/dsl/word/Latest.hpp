@@ -0,0 +1,236 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NUCLEAR_DSL_WORD_LATEST_HPP
+#define NUCLEAR_DSL_WORD_LATEST_HPP
+
+#include <map>
+#include <mutex>
+#include <type_traits>
+
+#include "../../util/Dereferencer.hpp"
+#include "../../util/Mutex.hpp"
+
+namespace NUClear {
+namespace dsl {
+    namespace word {
+
+        /**
+         * @brief Provides access to a single element of the data that a Latest task will run with.
+         *
+         * @details
+         *  All of the items for a task share the same data tuple. While the task is waiting in the queue this tuple is
+         *  replaced whenever newer data arrives, once the task starts the tuple is owned by the task alone.
+         *
+         * @tparam Data  the tuple type of the data that is being conflated
+         * @tparam Index the index of the element in the tuple that this item provides
+         */
+        template <typename Data, int Index>
+        struct LatestItem {
+        private:
+            using type = std::tuple_element_t<Index, Data>;
+
+            template <typename U, bool = util::is_dereferenceable<U>::value>
+            struct Deref {
+                static inline const U& get(const U& u) {
+                    return u;
+                }
+            };
+
+            template <typename U>
+            struct Deref<U, true> {
+                static inline auto get(const U& u) -> decltype(*u) {
+                    return *u;
+                }
+            };
+
+        public:
+            LatestItem(std::shared_ptr<Data> data) : data(std::move(data)) {}
+
+            auto operator*() const -> decltype(Deref<type>::get(std::declval<const type&>())) {
+                return Deref<type>::get(std::get<Index>(*data));
+            }
+
+            operator const type&() const {
+                return std::get<Index>(*data);
+            }
+
+            operator bool() const {
+                return data && static_cast<bool>(std::get<Index>(*data));
+            }
+
+            std::shared_ptr<Data> data;
+        };
+
+        /**
+         * @brief
+         *  This is used to conflate the data for the associated reaction, so that a task always runs with the most
+         *  recent data available.
+         *
+         * @details
+         *  @code on<Latest<Trigger<T, ...>>>() @endcode
+         *  When this keyword is used, at most one task for the subscribing reaction will be waiting to execute at any
+         *  given time. If the reaction is triggered while a task is still waiting in the queue, no new task is created.
+         *  Instead the data bound to the waiting task is replaced with the new data. Once a task has started executing,
+         *  its data will no longer change and the next trigger will create a new task.
+         *
+         *  This is useful for high rate sources (such as cameras) where a slow reaction would otherwise end up
+         *  processing a backlog of stale data. Unlike Single or Buffer, which drop the newest data, this keyword drops
+         *  the oldest data.
+         *
+         *  This word is a modifier, and should be used to modify any "Get" DSL word.
+         *
+         * @par Multiple Statements
+         *  @code on<Latest<Trigger<T1>, With<T2>>>() @endcode
+         *  When applying this modifier to multiple get statements, all of the data is replaced together so that the
+         *  task will always run with a consistent set of data.
+         *
+         * @par Implements
+         *  Modification, Precondition, Reschedule
+         *
+         * @tparam DSLWords
+         *  the DSL word/activity being modified.
+         */
+        template <typename... DSLWords>
+        struct Latest : public Fusion<DSLWords...> {
+        private:
+            using Words = Fusion<DSLWords...>;
+            template <typename DSL>
+            using Data = decltype(Words::template get<DSL>(std::declval<threading::Reaction&>()));
+
+            /**
+             * @brief Holds the data for the task that is waiting in the queue for a reaction.
+             */
+            struct Slot {
+                /// @brief the data for the waiting task, expires if the task is started or was never created
+                std::weak_ptr<void> pending;
+            };
+
+            /// @brief the slots for each of the reactions that use this modifier, indexed by reaction id
+            static std::map<uint64_t, Slot> slots;
+            /// @brief a mutex to ensure data consistency
+            static util::Mutex mutex;
+
+            template <typename... T, int... Index>
+            static inline bool valid(const std::tuple<T...>& data, util::Sequence<Index...>) {
+                for (bool v : {true, static_cast<bool>(std::get<Index>(data))...}) {
+                    if (!v) { return false; }
+                }
+                return true;
+            }
+
+            template <typename D, int... Index>
+            static inline std::tuple<LatestItem<D, Index>...> wrap(const std::shared_ptr<D>& data,
+                                                                   util::Sequence<Index...>) {
+                return std::make_tuple(LatestItem<D, Index>(data)...);
+            }
+
+        public:
+            template <typename DSL, typename... Arguments>
+            static inline auto bind(const std::shared_ptr<threading::Reaction>& reaction, Arguments&&... args)
+                -> decltype(Words::template bind<DSL>(reaction, std::forward<Arguments>(args)...)) {
+
+                // Remove our slot when the reaction is unbound
+                reaction->unbinders.push_back([](threading::Reaction& r) {
+                    std::lock_guard<util::Mutex> lock(mutex);
+                    slots.erase(r.id);
+                });
+
+                return Words::template bind<DSL>(reaction, std::forward<Arguments>(args)...);
+            }
+
+            template <typename DSL>
+            static inline bool precondition(threading::Reaction& r) {
+
+                // Run any preconditions of the words we are modifying first
+                if (!std::conditional_t<fusion::has_precondition<Words>::value, Words, fusion::NoOp>::
+                        template precondition<DSL>(r)) {
+                    return false;
+                }
+
+                std::lock_guard<util::Mutex> lock(mutex);
+                auto pending = slots[r.id].pending.lock();
+
+                // If there is already a task waiting, give it our newer data instead of making a new task
+                if (pending) {
+                    auto data = Words::template get<DSL>(r);
+                    if (valid(data, util::GenerateSequence<0, std::tuple_size<Data<DSL>>::value>())) {
+                        *std::static_pointer_cast<Data<DSL>>(pending) = std::move(data);
+                    }
+                    return false;
+                }
+
+                return true;
+            }
+
+            template <typename DSL>
+            static inline auto get(threading::Reaction& r)
+                -> decltype(wrap(std::declval<std::shared_ptr<Data<DSL>>>(),
+                                 util::GenerateSequence<0, std::tuple_size<Data<DSL>>::value>())) {
+
+                using Sequence = util::GenerateSequence<0, std::tuple_size<Data<DSL>>::value>;
+                auto data      = std::make_shared<Data<DSL>>(Words::template get<DSL>(r));
+
+                // If our data is good this becomes the waiting task (if it isn't the task will not be created)
+                // Only the task holds a reference to the data, so if another word stops the task from being created the
+                // slot expires along with it and the next trigger will make a new task
+                if (valid(*data, Sequence())) {
+                    std::lock_guard<util::Mutex> lock(mutex);
+                    auto& slot   = slots[r.id];
+                    auto pending = slot.pending.lock();
+
+                    // Another thread beat us here, give it our data and cancel this task
+                    if (pending) {
+                        *std::static_pointer_cast<Data<DSL>>(pending) = std::move(*data);
+                        data.reset();
+                    }
+                    else {
+                        slot.pending = data;
+                    }
+                }
+
+                return wrap(data, Sequence());
+            }
+
+            template <typename DSL>
+            static inline std::unique_ptr<threading::ReactionTask> reschedule(
+                std::unique_ptr<threading::ReactionTask>&& task) {
+
+                /* Mutex Scope */ {
+                    // We are starting so our data is now fixed, anything new will need a new task
+                    std::lock_guard<util::Mutex> lock(mutex);
+                    slots[task->parent.id].pending.reset();
+                }
+
+                // Pass our task on to any words we are modifying that want to reschedule it
+                return std::conditional_t<fusion::has_reschedule<Words>::value, Words, fusion::NoOp>::
+                    template reschedule<DSL>(std::move(task));
+            }
+        };
+
+        template <typename... DSLWords>
+        std::map<uint64_t, typename Latest<DSLWords...>::Slot> Latest<DSLWords...>::slots;
+
+        template <typename... DSLWords>
+        util::Mutex Latest<DSLWords...>::mutex("Latest", &util::lock_key<DSLWords...>);
+
+    }  // namespace word
+}  // namespace dsl
+}  // namespace NUClear
+
+#endif  // NUCLEAR_DSL_WORD_LATEST_HPP
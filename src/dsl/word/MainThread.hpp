@@ -33,6 +33,9 @@ namespace dsl {
          *  @code on<Trigger<T, ...>, MainThread>() @endcode
          *  This will most likely be used with graphics related tasks.
          *
+         *  The main thread is the thread that called start on the PowerPlant, so when several PowerPlants are run in
+         *  one process each has its own main thread.
+         *
          *  For best use, this word should be fused with at least one other binding DSL word.
          *
          * @par Implements
@@ -47,7 +50,7 @@ namespace dsl {
                 std::unique_ptr<threading::ReactionTask>&& task) {
 
                 // If we are not the main thread, move us to the main thread
-                if (std::this_thread::get_id() != util::main_thread_id) {
+                if (std::this_thread::get_id() != task->parent.reactor.powerplant.main_thread_id) {
 
                     // Submit to the main thread scheduler
                     task->parent.reactor.powerplant.submit_main(std::move(task));
@@ -0,0 +1,90 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NUCLEAR_DSL_WORD_NEAREST_HPP
+#define NUCLEAR_DSL_WORD_NEAREST_HPP
+
+#include "../operation/CacheGet.hpp"
+#include "../store/TimeStore.hpp"
+
+namespace NUClear {
+namespace dsl {
+    namespace word {
+
+        /**
+         * @brief
+         *  This is used to provide a reaction with the data of a type that is closest in time to the data that
+         *  triggered it.
+         *
+         * @details
+         *  @code on<Trigger<T1>, With<Nearest<T2>>>() @endcode
+         *  During system runtime, the PowerPlant will keep the last n emissions of T2 ordered by their timestamp. When
+         *  T1 is emitted into the system, read-only access to the copy of T2 whose timestamp is closest to the
+         *  timestamp of T1 will be provided to the reaction. This is useful for sensor fusion, for example finding the
+         *  odometry that was measured closest to when an image was captured.
+         *
+         *  The timestamps are read using NUClear::dsl::trait::timestamp, which by default uses a member called
+         *  timestamp. If the triggering data does not have a timestamp, the current time will be used instead.
+         *
+         *  If no data of T2 has been emitted, the task will be dropped. To override this functionality, include the
+         *  DSL keyword "Optional" in the request.
+         *
+         * @par Implements
+         *  Bind, Get
+         *
+         * @tparam T
+         *  the datatype which will be provided to the reaction, it must have a timestamp.
+         * @tparam n
+         *  the number of emissions of T to keep to search through.
+         */
+        template <typename T, size_t n = 100>
+        struct Nearest {
+
+            static_assert(trait::has_timestamp<T>::value,
+                          "The type used with Nearest must have a timestamp, either as a member called timestamp or "
+                          "by specialising NUClear::dsl::trait::timestamp");
+
+            template <typename DSL>
+            static inline void bind(const std::shared_ptr<threading::Reaction>& reaction) {
+                store::TimeStore<T>::reserve(reaction->reactor.powerplant.id, n);
+            }
+
+            template <typename DSL>
+            static inline std::shared_ptr<const T> get(threading::Reaction& r) {
+                return store::TimeStore<T>::nearest(r.reactor.powerplant.id, store::TimeStore<T>::reference());
+            }
+        };
+
+    }  // namespace word
+
+    namespace operation {
+
+        /**
+         * @brief Allows Nearest to be used within a With statement
+         *
+         * @tparam T the datatype which will be provided to the reaction
+         * @tparam n the number of emissions of T to keep to search through
+         */
+        template <typename T, size_t n>
+        struct CacheGet<word::Nearest<T, n>> : public word::Nearest<T, n> {};
+
+    }  // namespace operation
+}  // namespace dsl
+}  // namespace NUClear
+
+#endif  // NUCLEAR_DSL_WORD_NEAREST_HPP
@@ -0,0 +1,114 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NUCLEAR_DSL_WORD_PERSIST_HPP
+#define NUCLEAR_DSL_WORD_PERSIST_HPP
+
+#include <functional>
+
+#include "../../util/serialise/Serialise.hpp"
+#include "../operation/CacheGet.hpp"
+#include "../store/DataStore.hpp"
+
+namespace NUClear {
+namespace dsl {
+    namespace word {
+
+        struct PersistType {
+            PersistType() : hash(), latest(), serialise(), restore() {}
+
+            /// The hash identifying the type of object
+            uint64_t hash;
+            /// Gets the data that is currently in the DataStore for this type
+            std::function<std::shared_ptr<const void>()> latest;
+            /// Serialises data that was returned from latest
+            std::function<std::vector<char>(const std::shared_ptr<const void>&)> serialise;
+            /// Emits data from a snapshot, unless data has already been emitted for this type
+            std::function<void(const std::vector<char>&)> restore;
+        };
+
+        /**
+         * @brief
+         *  This is used to get the latest data of a type, and to keep that data across restarts.
+         *
+         * @details
+         *  @code on<Trigger<T1>, Persist<T2>>() @endcode
+         *  This works in the same way as With. In addition, the latest T2 is periodically written to a snapshot file,
+         *  and when the system starts again it is restored from the snapshot and emitted with Scope::INITIALIZE. This
+         *  way reactions that depend on data that is rarely emitted (such as calibration) can run as soon as the
+         *  system has started, rather than waiting for the data to be emitted again.
+         *
+         *  Persistence is only active once a PersistenceConfiguration message has been emitted to give the path of
+         *  the snapshot file:
+         *  @code emit<Scope::INITIALIZE>(std::make_unique<PersistenceConfiguration>("state.snapshot")); @endcode
+         *
+         *  Data from a snapshot is only restored if nothing has been emitted for the type yet in this PowerPlant, so
+         *  restoring never replaces newer data.
+         *
+         * @par Implements
+         *  Bind, Get
+         *
+         * @tparam T
+         *  the datatype to persist. It must be serialisable with util::serialise::Serialise.
+         */
+        template <typename T>
+        struct Persist {
+
+            template <typename DSL>
+            static inline void bind(const std::shared_ptr<threading::Reaction>& reaction) {
+
+                PowerPlant& powerplant = reaction->reactor.powerplant;
+
+                auto type  = std::make_unique<PersistType>();
+                type->hash = util::serialise::Serialise<T>::hash();
+
+                type->latest = [&powerplant] {
+                    return std::shared_ptr<const void>(store::DataStore<T>::get(powerplant.id));
+                };
+
+                type->serialise = [](const std::shared_ptr<const void>& data) {
+                    return util::serialise::Serialise<T>::serialise(*std::static_pointer_cast<const T>(data));
+                };
+
+                type->restore = [&powerplant](const std::vector<char>& payload) {
+                    // Newer data has already been emitted in this PowerPlant (the store is cleared between PowerPlants)
+                    if (store::DataStore<T>::get(powerplant.id)) { return; }
+
+                    auto data = std::make_unique<T>(util::serialise::Serialise<T>::deserialise(payload));
+
+                    // Once the system is starting we can no longer wait for it to start
+                    if (powerplant.running()) { powerplant.emit<emit::Direct>(data); }
+                    else {
+                        powerplant.emit<emit::Initialise>(data);
+                    }
+                };
+
+                reaction->reactor.emit<emit::Direct>(type);
+            }
+
+            template <typename DSL>
+            static inline std::shared_ptr<const T> get(threading::Reaction& r) {
+                return operation::CacheGet<T>::template get<DSL>(r);
+            }
+        };
+
+    }  // namespace word
+}  // namespace dsl
+}  // namespace NUClear
+
+#endif  // NUCLEAR_DSL_WORD_PERSIST_HPP
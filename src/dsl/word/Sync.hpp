@@ -19,6 +19,20 @@
 #ifndef NUCLEAR_DSL_WORD_SYNC_HPP
 #define NUCLEAR_DSL_WORD_SYNC_HPP
 
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <queue>
+#include <typeinfo>
+
+#include "../../util/FlightRecorder.hpp"
+#include "../../util/LockProfiler.hpp"
+#include "../../util/Mutex.hpp"
+#include "../../util/demangle.hpp"
+#include "../../util/powerplant_slots.hpp"
+
 namespace NUClear {
 namespace dsl {
     namespace word {
@@ -39,6 +53,8 @@ namespace dsl {
          *
          *  Tasks in the synchronization queue are ordered based on their priority level, then their emission timestamp.
          *
+         *  Each PowerPlant synchronises its own tasks, so a group never blocks tasks that belong to another PowerPlant.
+         *
          *  For best use, this word should be fused with at least one other binding DSL word.
          *
          * @par When should I use Sync
@@ -65,27 +81,96 @@ namespace dsl {
 
             using task_ptr = std::unique_ptr<threading::ReactionTask>;
 
-            /// @brief our queue which sorts tasks by priority
-            static std::priority_queue<task_ptr> queue;
-            /// @brief how many tasks are currently running
-            static volatile bool running;
-            /// @brief a mutex to ensure data consistency
-            static std::mutex mutex;
+            /**
+             * @brief The state of this sync group in a single PowerPlant
+             */
+            struct State {
+                /// @brief our queue which sorts tasks by priority
+                std::priority_queue<task_ptr> queue;
+                /// @brief how many tasks are currently running
+                bool running = false;
+                /// @brief a mutex to ensure data consistency
+                util::Mutex mutex{"Sync"};
+#ifdef NUCLEAR_PROFILE_LOCKS
+                /// @brief when the running task took the group
+                std::chrono::steady_clock::time_point acquired;
+                /// @brief when each queued task first had to wait for the group
+                std::map<uint64_t, std::chrono::steady_clock::time_point> waiting;
+#endif
+            };
+
+            /// @brief the state of this group for each PowerPlant
+            static std::array<State, util::max_powerplants> state;
+
+            /// @brief clears the state of a destroyed PowerPlant so the next to use its slot starts idle
+            static void reset(size_t plant) {
+                State& s = state[plant];
+                std::lock_guard<util::Mutex> lock(s.mutex);
+                s.queue   = std::priority_queue<task_ptr>();
+                s.running = false;
+#ifdef NUCLEAR_PROFILE_LOCKS
+                s.waiting.clear();
+#endif
+            }
+
+#ifdef NUCLEAR_PROFILE_LOCKS
+            /// @brief the counters of this group in the LockProfiler, where the group is counted as if it were a lock
+            static util::LockProfiler::Lock& profile() {
+                static util::LockProfiler::Lock& lock =
+                    util::LockProfiler::find("Sync<" + util::demangle(typeid(SyncGroup).name()) + ">");
+                return lock;
+            }
+
+            /// @brief counts a task having to queue for the group, the lock on the state must be held
+            static void blocked(State& s, const threading::ReactionTask& task) {
+                // A task can be queued more than once before it runs, it has been waiting since the first time
+                s.waiting.emplace(task.id, std::chrono::steady_clock::now());
+            }
+
+            /// @brief counts a task taking the group, the lock on the state must be held
+            static void acquired(State& s, const threading::ReactionTask& task) {
+                s.acquired = std::chrono::steady_clock::now();
+                auto it    = s.waiting.find(task.id);
+                if (it != s.waiting.end()) {
+                    profile().acquired(std::max(std::chrono::nanoseconds(1), s.acquired - it->second));
+                    s.waiting.erase(it);
+                }
+                else {
+                    profile().acquired(std::chrono::nanoseconds(0));
+                }
+            }
+
+            /// @brief counts the running task giving up the group, the lock on the state must be held
+            static void released(State& s) {
+                profile().released(std::chrono::steady_clock::now() - s.acquired);
+            }
+#else
+            static void blocked(State& /*s*/, const threading::ReactionTask& /*task*/) {}
+            static void acquired(State& /*s*/, const threading::ReactionTask& /*task*/) {}
+            static void released(State& /*s*/) {}
+#endif  // NUCLEAR_PROFILE_LOCKS
 
             template <typename DSL>
             static inline std::unique_ptr<threading::ReactionTask> reschedule(
                 std::unique_ptr<threading::ReactionTask>&& task) {
 
+                static const util::SlotReset registered(&Sync::reset);
+
+                State& s = state[task->parent.reactor.powerplant.id];
+
                 // Lock our mutex
-                std::lock_guard<std::mutex> lock(mutex);
+                std::lock_guard<util::Mutex> lock(s.mutex);
 
                 // If we are already running then queue, otherwise return and set running
-                if (running) {
-                    queue.push(std::move(task));
+                if (s.running) {
+                    util::FlightRecorder::record(util::FlightRecorder::Event::SYNC_BLOCK, task->parent.id, task->id);
+                    blocked(s, *task);
+                    s.queue.push(std::move(task));
                     return std::unique_ptr<threading::ReactionTask>(nullptr);
                 }
                 else {
-                    running = true;
+                    s.running = true;
+                    acquired(s, *task);
                     return std::move(task);
                 }
             }
@@ -93,17 +178,21 @@ namespace dsl {
             template <typename DSL>
             static void postcondition(threading::ReactionTask& task) {
 
+                State& s = state[task.parent.reactor.powerplant.id];
+
                 // Lock our mutex
-                std::lock_guard<std::mutex> lock(mutex);
+                std::lock_guard<util::Mutex> lock(s.mutex);
 
                 // We are finished running
-                running = false;
+                s.running = false;
+                released(s);
+                util::FlightRecorder::record(util::FlightRecorder::Event::SYNC_RELEASE, task.parent.id, task.id);
 
                 // If we have another task, add it
-                if (!queue.empty()) {
+                if (!s.queue.empty()) {
                     std::unique_ptr<threading::ReactionTask> next_task(
-                        std::move(const_cast<std::unique_ptr<threading::ReactionTask>&>(queue.top())));
-                    queue.pop();
+                        std::move(const_cast<std::unique_ptr<threading::ReactionTask>&>(s.queue.top())));
+                    s.queue.pop();
 
                     // Resubmit this task to the reaction queue
                     task.parent.reactor.powerplant.submit(std::move(next_task));
@@ -112,13 +201,7 @@ namespace dsl {
         };
 
         template <typename SyncGroup>
-        std::priority_queue<typename Sync<SyncGroup>::task_ptr> Sync<SyncGroup>::queue;
-
-        template <typename SyncGroup>
-        volatile bool Sync<SyncGroup>::running = false;
-
-        template <typename SyncGroup>
-        std::mutex Sync<SyncGroup>::mutex;
+        std::array<typename Sync<SyncGroup>::State, util::max_powerplants> Sync<SyncGroup>::state;
 
     }  // namespace word
 }  // namespace dsl
@@ -0,0 +1,164 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NUCLEAR_DSL_WORD_THROTTLE_HPP
+#define NUCLEAR_DSL_WORD_THROTTLE_HPP
+
+#include <map>
+#include <mutex>
+
+#include "../../util/Mutex.hpp"
+#include "../operation/ChronoTask.hpp"
+#include "../operation/Unbind.hpp"
+#include "emit/Direct.hpp"
+#include "emit/Local.hpp"
+
+namespace NUClear {
+namespace dsl {
+    namespace word {
+
+        /**
+         * @brief
+         *  This is used to limit how often a reaction can run, no matter how often it is triggered.
+         *
+         * @details
+         *  @code on<Trigger<T>, Throttle<ticks, period>>() @endcode
+         *  The subscribing reaction will run at most once per period. The first trigger in a period will run straight
+         *  away, and any further triggers within that period will not create a task. If any triggers were dropped,
+         *  the reaction will run once more at the end of the period with the latest data, so the last data is never
+         *  lost.
+         *
+         *  This is useful for reactions such as diagnostics or displays that are triggered by high rate data, but only
+         *  need to keep up with it at a low rate.
+         *
+         *  @code on<Trigger<T>, Throttle<10, Per<std::chrono::seconds>>>() @endcode
+         *  As with Every, the period can be wrapped in a Per<> to specify a frequency.
+         *
+         * @par Implements
+         *  Bind, Precondition
+         *
+         * @tparam ticks
+         *  the number of ticks of a particular type that must pass between runs
+         * @tparam period
+         *  a type of duration (e.g. std::chrono::seconds) to measure the ticks in
+         */
+        template <int ticks, class period = NUClear::clock::duration>
+        struct Throttle {
+        private:
+            /**
+             * @brief Holds the throttling state for a reaction
+             */
+            struct State {
+                /// @brief the reaction this state is for, so it can be run at the end of the period
+                std::weak_ptr<threading::Reaction> reaction;
+                /// @brief the earliest time that the reaction may run again
+                NUClear::clock::time_point next;
+                /// @brief if a run at the end of the period has been scheduled
+                bool scheduled = false;
+            };
+
+            /// @brief the state for each of the reactions that use this word, indexed by reaction id
+            static std::map<uint64_t, State> states;
+            /// @brief a mutex to ensure data consistency
+            static util::Mutex mutex;
+
+            static void run(uint64_t id) {
+
+                std::shared_ptr<threading::Reaction> reaction;
+                /* Mutex Scope */ {
+                    std::lock_guard<util::Mutex> lock(mutex);
+                    auto it = states.find(id);
+
+                    // If the reaction was unbound there is nothing to run
+                    if (it == states.end()) { return; }
+
+                    it->second.scheduled = false;
+                    reaction             = it->second.reaction.lock();
+                }
+
+                if (reaction) {
+                    auto task = reaction->get_task();
+                    if (task) { reaction->reactor.powerplant.submit(std::move(task)); }
+                }
+            }
+
+        public:
+            template <typename DSL>
+            static inline void bind(const std::shared_ptr<threading::Reaction>& reaction) {
+
+                /* Mutex Scope */ {
+                    std::lock_guard<util::Mutex> lock(mutex);
+                    states[reaction->id].reaction = reaction;
+                }
+
+                reaction->unbinders.push_back([](const threading::Reaction& r) {
+                    /* Mutex Scope */ {
+                        std::lock_guard<util::Mutex> lock(mutex);
+                        states.erase(r.id);
+                    }
+                    r.reactor.emit<emit::Direct>(std::make_unique<operation::Unbind<operation::ChronoTask>>(r.id));
+                });
+            }
+
+            template <typename DSL>
+            static inline bool precondition(threading::Reaction& r) {
+
+                auto now = NUClear::clock::now();
+                NUClear::clock::time_point next;
+
+                /* Mutex Scope */ {
+                    std::lock_guard<util::Mutex> lock(mutex);
+                    auto& state = states[r.id];
+
+                    // We are allowed to run, the next run must be a period away
+                    if (now >= state.next) {
+                        state.next = now + period(ticks);
+                        return true;
+                    }
+
+                    // We can't run yet, but we will run once the period is over
+                    if (state.scheduled) { return false; }
+                    state.scheduled = true;
+                    next            = state.next;
+                }
+
+                // This is emitted locally as we may be running from inside the chrono controller
+                uint64_t id = r.id;
+                r.reactor.emit<emit::Local>(std::make_unique<operation::ChronoTask>(
+                    [id](NUClear::clock::time_point&) {
+                        run(id);
+                        return false;
+                    },
+                    next,
+                    id));
+
+                return false;
+            }
+        };
+
+        template <int ticks, class period>
+        std::map<uint64_t, typename Throttle<ticks, period>::State> Throttle<ticks, period>::states;
+
+        template <int ticks, class period>
+        util::Mutex Throttle<ticks, period>::mutex("Throttle");
+
+    }  // namespace word
+}  // namespace dsl
+}  // namespace NUClear
+
+#endif  // NUCLEAR_DSL_WORD_THROTTLE_HPP
@@ -20,6 +20,7 @@
 #define NUCLEAR_DSL_WORD_WATCHDOG_HPP
 
 #include "../../util/demangle.hpp"
+#include "../../util/powerplant_slots.hpp"
 #include "../operation/Unbind.hpp"
 #include "../store/DataStore.hpp"
 #include "emit/Direct.hpp"
@@ -43,43 +44,56 @@ namespace dsl {
         template <typename WatchdogGroup, typename RuntimeType = void>
         struct WatchdogDataStore {
             using MapType       = std::remove_cv_t<RuntimeType>;
-            using WatchdogStore = util::TypeMap<WatchdogGroup, MapType, std::map<MapType, NUClear::clock::time_point>>;
+            using Stores        = std::array<std::map<MapType, NUClear::clock::time_point>, util::max_powerplants>;
+            using WatchdogStore = util::TypeMap<WatchdogGroup, MapType, Stores>;
+
+            /**
+             * @brief Gets the service times for every PowerPlant, creating them the first time they are needed
+             */
+            static std::shared_ptr<Stores> stores() {
+                // This only happens once, so PowerPlants that bind at the same time can't replace each other's store
+                static const auto s = [] {
+                    auto store = std::make_shared<Stores>();
+                    WatchdogStore::set(store);
+                    return store;
+                }();
+                return s;
+            }
 
             /**
              * @brief Ensures the data store is initialised correctly
              *
-             * @param data The runtime argument for the current watchdog in the WatchdogGroup/RuntimeType group
+             * @param plant the slot of the PowerPlant the watchdog is in
+             * @param data  The runtime argument for the current watchdog in the WatchdogGroup/RuntimeType group
              */
-            static void init(const RuntimeType& data) {
-                if (WatchdogStore::get() == nullptr) {
-                    WatchdogStore::set(std::make_shared<std::map<MapType, NUClear::clock::time_point>>());
-                }
-                if (WatchdogStore::get()->count(data) == 0) {
-                    WatchdogStore::get()->insert({data, NUClear::clock::now()});
-                }
+            static void init(size_t plant, const RuntimeType& data) {
+                auto& store = (*stores())[plant];
+                if (store.count(data) == 0) { store.insert({data, NUClear::clock::now()}); }
             }
 
             /**
              * @brief Gets the current service time for the WatchdogGroup/RuntimeType/data watchdog
              *
-             * @param data The runtime argument for the current watchdog in the WatchdogGroup/RuntimeType group
+             * @param plant the slot of the PowerPlant the watchdog is in
+             * @param data  The runtime argument for the current watchdog in the WatchdogGroup/RuntimeType group
              */
-            static const NUClear::clock::time_point& get(const RuntimeType& data) {
-                if (WatchdogStore::get() == nullptr || WatchdogStore::get()->count(data) == 0) {
+            static const NUClear::clock::time_point& get(size_t plant, const RuntimeType& data) {
+                if (WatchdogStore::get() == nullptr || WatchdogStore::get()->at(plant).count(data) == 0) {
                     throw std::runtime_error("Store for <" + util::demangle(typeid(WatchdogGroup).name()) + ", "
                                              + util::demangle(typeid(MapType).name())
                                              + "> is trying to field a service call for an unknown data type");
                 }
-                return WatchdogStore::get()->at(data);
+                return WatchdogStore::get()->at(plant).at(data);
             }
 
             /**
              * @brief Cleans up any allocated storage for the WatchdogGroup/RuntimeType/data watchdog
              *
-             * @param data The runtime argument for the current watchdog in the WatchdogGroup/RuntimeType group
+             * @param plant the slot of the PowerPlant the watchdog is in
+             * @param data  The runtime argument for the current watchdog in the WatchdogGroup/RuntimeType group
              */
-            static void unbind(const RuntimeType& data) {
-                if (WatchdogStore::get() != nullptr) { WatchdogStore::get()->erase(data); }
+            static void unbind(size_t plant, const RuntimeType& data) {
+                if (WatchdogStore::get() != nullptr) { WatchdogStore::get()->at(plant).erase(data); }
             }
         };
 
@@ -95,33 +109,52 @@ namespace dsl {
          */
         template <typename WatchdogGroup>
         struct WatchdogDataStore<WatchdogGroup, void> {
-            using WatchdogStore = util::TypeMap<WatchdogGroup, void, NUClear::clock::time_point>;
+            using Stores        = std::array<std::shared_ptr<NUClear::clock::time_point>, util::max_powerplants>;
+            using WatchdogStore = util::TypeMap<WatchdogGroup, void, Stores>;
+
+            /**
+             * @brief Gets the service times for every PowerPlant, creating them the first time they are needed
+             */
+            static std::shared_ptr<Stores> stores() {
+                // This only happens once, so PowerPlants that bind at the same time can't replace each other's store
+                static const auto s = [] {
+                    auto store = std::make_shared<Stores>();
+                    WatchdogStore::set(store);
+                    return store;
+                }();
+                return s;
+            }
 
             /**
              * @brief Ensures the data store is initialised correctly
+             *
+             * @param plant the slot of the PowerPlant the watchdog is in
              */
-            static void init() {
-                if (WatchdogStore::get() == nullptr) {
-                    WatchdogStore::set(std::make_shared<NUClear::clock::time_point>(NUClear::clock::now()));
-                }
+            static void init(size_t plant) {
+                auto& store = (*stores())[plant];
+                if (store == nullptr) { store = std::make_shared<NUClear::clock::time_point>(NUClear::clock::now()); }
             }
 
             /**
              * @brief Gets the current service time for the WatchdogGroup watchdog
+             *
+             * @param plant the slot of the PowerPlant the watchdog is in
              */
-            static const NUClear::clock::time_point& get() {
-                if (WatchdogStore::get() == nullptr) {
+            static const NUClear::clock::time_point& get(size_t plant) {
+                if (WatchdogStore::get() == nullptr || WatchdogStore::get()->at(plant) == nullptr) {
                     throw std::runtime_error("Store for <" + util::demangle(typeid(WatchdogGroup).name())
                                              + "> is trying to field a service call for an unknown data type");
                 }
-                return *WatchdogStore::get();
+                return *WatchdogStore::get()->at(plant);
             }
 
             /**
              * @brief Cleans up any allocated storage for the WatchdogGroup watchdog
+             *
+             * @param plant the slot of the PowerPlant the watchdog is in
              */
-            static void unbind() {
-                if (WatchdogStore::get() != nullptr) { WatchdogStore::get().reset(); }
+            static void unbind(size_t plant) {
+                if (WatchdogStore::get() != nullptr) { WatchdogStore::get()->at(plant).reset(); }
             }
         };
 
@@ -158,7 +191,8 @@ namespace dsl {
          * @par Service the Watcdog
          *  @code  emit<Scope::WATCHDOG>(ServiceWatchdog<SampleReactor>()) @endcode
          *  The watchdog will need to be serviced by a watchdog service emission. The emission must use the same
-         *  template type as the watchdog. Each time this emission occurs, the watchdog timer will be reset.
+         *  template type as the watchdog. Each time this emission occurs, the watchdog timer will be reset. Each
+         *  PowerPlant has its own watchdogs, so this only resets the watchdog in the PowerPlant it was emitted in.
          *
          *  @code  emit<Scope::WATCHDOG>(ServiceWatchdog<SampleReactor>(data)) @endcode
          *  The watchdog will need to be serviced by a watchdog service emission. The emission must use the same
@@ -200,12 +234,12 @@ namespace dsl {
             static inline void bind(const std::shared_ptr<threading::Reaction>& reaction, const RuntimeType& data) {
 
                 // Make sure the store is initialised
-                WatchdogDataStore<WatchdogGroup, RuntimeType>::init(data);
+                WatchdogDataStore<WatchdogGroup, RuntimeType>::init(reaction->reactor.powerplant.id, data);
 
                 // Create our unbinder
                 reaction->unbinders.push_back([data](const threading::Reaction& r) {
                     // Remove the active service time from the data store
-                    WatchdogDataStore<WatchdogGroup, RuntimeType>::unbind(data);
+                    WatchdogDataStore<WatchdogGroup, RuntimeType>::unbind(r.reactor.powerplant.id, data);
                     r.reactor.emit<emit::Direct>(std::make_unique<operation::Unbind<operation::ChronoTask>>(r.id));
                 });
 
@@ -213,7 +247,9 @@ namespace dsl {
                 reaction->reactor.emit<emit::Direct>(std::make_unique<operation::ChronoTask>(
                     [reaction, data](NUClear::clock::time_point& time) {
                         return Watchdog::chrono_task(
-                            reaction, WatchdogDataStore<WatchdogGroup, RuntimeType>::get(data), time);
+                            reaction,
+                            WatchdogDataStore<WatchdogGroup, RuntimeType>::get(reaction->reactor.powerplant.id, data),
+                            time);
                     },
                     NUClear::clock::now() + period(ticks),
                     reaction->id));
@@ -226,19 +262,20 @@ namespace dsl {
             static inline void bind(const std::shared_ptr<threading::Reaction>& reaction) {
 
                 // Make sure the store is initialised
-                WatchdogDataStore<WatchdogGroup>::init();
+                WatchdogDataStore<WatchdogGroup>::init(reaction->reactor.powerplant.id);
 
                 // Create our unbinder
                 reaction->unbinders.push_back([](const threading::Reaction& r) {
                     // Remove the active service time from the data store
-                    WatchdogDataStore<WatchdogGroup>::unbind();
+                    WatchdogDataStore<WatchdogGroup>::unbind(r.reactor.powerplant.id);
                     r.reactor.emit<emit::Direct>(std::make_unique<operation::Unbind<operation::ChronoTask>>(r.id));
                 });
 
                 // Send our configuration out
                 reaction->reactor.emit<emit::Direct>(std::make_unique<operation::ChronoTask>(
                     [reaction](NUClear::clock::time_point& time) {
-                        return Watchdog::chrono_task(reaction, WatchdogDataStore<WatchdogGroup>::get(), time);
+                        return Watchdog::chrono_task(
+                            reaction, WatchdogDataStore<WatchdogGroup>::get(reaction->reactor.powerplant.id), time);
                     },
                     NUClear::clock::now() + period(ticks),
                     reaction->id));
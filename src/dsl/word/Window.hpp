@@ -0,0 +1,119 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NUCLEAR_DSL_WORD_WINDOW_HPP
+#define NUCLEAR_DSL_WORD_WINDOW_HPP
+
+#include "../operation/ChronoTask.hpp"
+#include "../operation/Unbind.hpp"
+#include "Batch.hpp"
+#include "emit/Direct.hpp"
+
+namespace NUClear {
+namespace dsl {
+    namespace word {
+
+        /**
+         * @brief
+         *  This is used to deliver all of the messages of a type that were emitted in a period to a reaction in a
+         *  single task.
+         *
+         * @details
+         *  @code on<Window<ticks, period, T>>() @endcode
+         *  Each time T is emitted it is added to a window for the subscribing reaction. At the end of each period,
+         *  a single task is created which is given all of the messages from that window, oldest first. If no messages
+         *  were emitted in the period then no task is created. When the reaction is also triggered by another word it
+         *  still only runs at the end of a period.
+         *
+         *  The window is provided as a vector.
+         *  @code .then([](const std::vector<std::shared_ptr<const T>>& window) { ... }) @endcode
+         *
+         * @par Implements
+         *  Bind, Get
+         *
+         * @tparam ticks
+         *  the number of ticks of a particular type in each window
+         * @tparam period
+         *  a type of duration (e.g. std::chrono::seconds) to measure the ticks in
+         * @tparam T
+         *  the datatype of the messages to collect
+         */
+        template <int ticks, class period, typename T>
+        struct Window : public Fusion<operation::TypeBind<T>> {
+
+            /// @brief Set while the timer of a Window is making a task, so its get knows to flush the window
+            struct Flush {
+                /// The reaction whose window is ending
+                uint64_t reaction_id;
+            };
+
+            template <typename DSL>
+            static inline void bind(const std::shared_ptr<threading::Reaction>& reaction) {
+
+                // Bind to our type so its emissions are added to the window
+                operation::TypeBind<T>::template bind<DSL>(reaction);
+
+                reaction->unbinders.push_back([](const threading::Reaction& r) {
+                    r.reactor.emit<emit::Direct>(std::make_unique<operation::Unbind<operation::ChronoTask>>(r.id));
+                });
+
+                // End the window each period
+                NUClear::clock::duration jump = period(ticks);
+                reaction->reactor.emit<emit::Direct>(std::make_unique<operation::ChronoTask>(
+                    [reaction, jump](NUClear::clock::time_point& time) {
+                        Flush flush{reaction->id};
+                        store::ThreadStore<Flush>::value = &flush;
+                        try {
+                            auto task = reaction->get_task();
+                            if (task) { reaction->reactor.powerplant.submit(std::move(task)); }
+                        }
+                        // If there is an exception while generating a reaction print it here, this shouldn't happen
+                        catch (const std::exception& ex) {
+                            reaction->reactor.log<NUClear::ERROR>("There was an exception while generating a reaction",
+                                                                  ex.what());
+                        }
+                        catch (...) {
+                            reaction->reactor.log<NUClear::ERROR>(
+                                "There was an unknown exception while generating a reaction");
+                        }
+                        store::ThreadStore<Flush>::value = nullptr;
+
+                        time += jump;
+
+                        return true;
+                    },
+                    NUClear::clock::now() + jump,
+                    reaction->id));
+            }
+
+            template <typename DSL>
+            static inline BatchStorage<0, T> get(threading::Reaction& reaction) {
+
+                // Only our own timer ends the window, any other word triggering us leaves it open
+                auto data  = store::ThreadStore<std::shared_ptr<T>>::value;
+                auto flush = store::ThreadStore<Flush>::value;
+                return BatchStorage<0, T>(data == nullptr ? nullptr : std::shared_ptr<const T>(*data),
+                                          flush != nullptr && flush->reaction_id == reaction.id);
+            }
+        };
+
+    }  // namespace word
+}  // namespace dsl
+}  // namespace NUClear
+
+#endif  // NUCLEAR_DSL_WORD_WINDOW_HPP
@@ -21,7 +21,9 @@
 
 #include "../../../PowerPlant.hpp"
 #include "../../store/DataStore.hpp"
+#include "../../store/HistoryStore.hpp"
 #include "../../store/ThreadStore.hpp"
+#include "../../store/TimeStore.hpp"
 #include "../../store/TypeCallbackStore.hpp"
 
 namespace NUClear {
@@ -54,12 +56,20 @@ namespace dsl {
 
                 static void emit(PowerPlant& powerplant, std::shared_ptr<DataType> data) {
 
+                    // Record our data in the stores that keep past data for this type (so reactions we trigger can
+                    // see it)
+                    store::HistoryStore<DataType>::push(powerplant.id, data);
+                    store::TimeStore<DataType>::push(powerplant.id, data);
+                    clock::time_point storage;
+                    clock::time_point* time = store::TimeStore<DataType>::time(data, storage);
+
                     // Run all our reactions that are interested
-                    for (auto& reaction : store::TypeCallbackStore<DataType>::get()) {
+                    for (auto& reaction : store::TypeCallbackStore<DataType>::get(powerplant.id)) {
                         try {
 
                             // Set our thread local store data each time (as during direct it can be overwritten)
                             store::ThreadStore<std::shared_ptr<DataType>>::value = &data;
+                            store::ThreadStore<clock::time_point>::value         = time;
 
                             auto task = reaction->get_task();
                             if (task) {
@@ -78,9 +88,10 @@ namespace dsl {
 
                     // Unset our thread local store data
                     store::ThreadStore<std::shared_ptr<DataType>>::value = nullptr;
+                    store::ThreadStore<clock::time_point>::value         = nullptr;
 
                     // Set the data into the global store
-                    store::DataStore<DataType>::set(data);
+                    store::DataStore<DataType>::set(powerplant.id, data);
                 }
             };
 
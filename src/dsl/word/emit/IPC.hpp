@@ -0,0 +1,80 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NUCLEAR_DSL_WORD_EMIT_IPC_HPP
+#define NUCLEAR_DSL_WORD_EMIT_IPC_HPP
+
+#include <functional>
+
+#include "../../../util/serialise/Serialise.hpp"
+
+namespace NUClear {
+namespace dsl {
+    namespace word {
+        namespace emit {
+            struct IPCEmit {
+                IPCEmit() : hash(), size(0), fill() {}
+
+                /// The hash identifying the type of object
+                uint64_t hash;
+                /// The size of the serialised data
+                size_t size;
+                /// Serialises the data straight into the memory it is given
+                std::function<void(char*)> fill;
+            };
+
+            /**
+             * @brief
+             *  Emits data through shared memory to other NUClear processes on the same host.
+             *
+             * @details
+             *  @code emit<Scope::IPC>(data); @endcode
+             *  Data emitted under this scope is written into the shared memory ring for its type, where it can be
+             *  read by every process that has an on<IPC<T>> reaction for it (including this one). The data is
+             *  serialised straight into shared memory, so it is only copied once. The serialised data can be at most
+             *  8 MiB.
+             *
+             * @attention
+             *  Data sent under this scope will only trigger reactions (create tasks) for any associated IPC requests
+             *  of this datatype.  For example:
+             *  @code on<IPC<T>> @endcode
+             *  Tasks generated by this emission are assigned to the threadpool on the receiving process.
+             *
+             * @param data      the data to emit
+             * @tparam DataType the type of the data to send
+             */
+            template <typename DataType>
+            struct IPC {
+
+                static void emit(PowerPlant& powerplant, std::shared_ptr<DataType> data) {
+
+                    auto e  = std::make_unique<IPCEmit>();
+                    e->hash = util::serialise::Serialise<DataType>::hash();
+                    e->size = util::serialise::Serialise<DataType>::size(*data);
+                    e->fill = [data](char* out) { util::serialise::Serialise<DataType>::serialise(*data, out); };
+
+                    powerplant.emit<Direct>(e);
+                }
+            };
+
+        }  // namespace emit
+    }      // namespace word
+}  // namespace dsl
+}  // namespace NUClear
+
+#endif  // NUCLEAR_DSL_WORD_EMIT_IPC_HPP
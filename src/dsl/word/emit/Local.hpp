@@ -22,8 +22,11 @@
 #include "../../../PowerPlant.hpp"
 #include "../../../util/TypeMap.hpp"
 #include "../../store/DataStore.hpp"
+#include "../../store/HistoryStore.hpp"
 #include "../../store/ThreadStore.hpp"
+#include "../../store/TimeStore.hpp"
 #include "../../store/TypeCallbackStore.hpp"
+#include "../Inline.hpp"
 
 namespace NUClear {
 namespace dsl {
@@ -51,14 +54,23 @@ namespace dsl {
 
                 static void emit(PowerPlant& powerplant, std::shared_ptr<DataType> data) {
 
-                    // Set our thread local store data
-                    store::ThreadStore<std::shared_ptr<DataType>>::value = &data;
+                    // Record our data in the stores that keep past data for this type (so reactions we trigger can
+                    // see it)
+                    store::HistoryStore<DataType>::push(powerplant.id, data);
+                    store::TimeStore<DataType>::push(powerplant.id, data);
+
+                    clock::time_point storage;
+                    clock::time_point* time = store::TimeStore<DataType>::time(data, storage);
 
                     // Run all our reactions that are interested
-                    for (auto& reaction : store::TypeCallbackStore<DataType>::get()) {
+                    for (auto& reaction : store::TypeCallbackStore<DataType>::get(powerplant.id)) {
                         try {
+                            // Set our thread local store data each time (as an inline task can overwrite it)
+                            store::ThreadStore<std::shared_ptr<DataType>>::value = &data;
+                            store::ThreadStore<clock::time_point>::value         = time;
+
                             auto task = reaction->get_task();
-                            if (task) { powerplant.submit(std::move(task)); }
+                            if (task && !Inline::run(task)) { powerplant.submit(std::move(task)); }
                         }
                         // If there is an exception while generating a reaction print it here, this shouldn't happen
                         catch (const std::exception& ex) {
@@ -73,9 +85,10 @@ namespace dsl {
 
                     // Unset our thread local store data
                     store::ThreadStore<std::shared_ptr<DataType>>::value = nullptr;
+                    store::ThreadStore<clock::time_point>::value         = nullptr;
 
                     // Set the data into the global store
-                    store::DataStore<DataType>::set(data);
+                    store::DataStore<DataType>::set(powerplant.id, data);
                 }
             };
 
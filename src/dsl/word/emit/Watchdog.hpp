@@ -21,6 +21,7 @@
 #include "../../../PowerPlant.hpp"
 #include "../../../util/TypeMap.hpp"
 #include "../../../util/demangle.hpp"
+#include "../../../util/powerplant_slots.hpp"
 
 namespace NUClear {
 namespace dsl {
@@ -41,9 +42,9 @@ namespace dsl {
              */
             template <typename WatchdogGroup, typename RuntimeType = void>
             struct WatchdogServicer {
-                using MapType = std::remove_cv_t<RuntimeType>;
-                using WatchdogStore =
-                    util::TypeMap<WatchdogGroup, MapType, std::map<MapType, NUClear::clock::time_point>>;
+                using MapType       = std::remove_cv_t<RuntimeType>;
+                using Stores        = std::array<std::map<MapType, NUClear::clock::time_point>, util::max_powerplants>;
+                using WatchdogStore = util::TypeMap<WatchdogGroup, MapType, Stores>;
 
                 WatchdogServicer() : when(NUClear::clock::now()), data() {}
                 WatchdogServicer(const RuntimeType& data) : when(NUClear::clock::now()), data(data) {}
@@ -54,14 +55,16 @@ namespace dsl {
                  * @details
                  *  The watchdog timer that is specified by the WatchdogGroup/RuntimeType/data
                  *  combination will have its service time updated to whatever is stored in when
+                 *
+                 * @param plant the slot of the PowerPlant the watchdog is in
                  */
-                void service() {
-                    if (WatchdogStore::get() == nullptr || WatchdogStore::get()->count(data) == 0) {
+                void service(size_t plant) {
+                    if (WatchdogStore::get() == nullptr || WatchdogStore::get()->at(plant).count(data) == 0) {
                         throw std::runtime_error("Store for <" + util::demangle(typeid(WatchdogGroup).name()) + ", "
                                                  + util::demangle(typeid(RuntimeType).name())
                                                  + "> has not been created yet or no watchdog has been set up");
                     }
-                    WatchdogStore::get()->at(data) = when;
+                    WatchdogStore::get()->at(plant).at(data) = when;
                 }
 
             private:
@@ -81,7 +84,8 @@ namespace dsl {
              */
             template <typename WatchdogGroup>
             struct WatchdogServicer<WatchdogGroup, void> {
-                using WatchdogStore = util::TypeMap<WatchdogGroup, void, NUClear::clock::time_point>;
+                using Stores        = std::array<std::shared_ptr<NUClear::clock::time_point>, util::max_powerplants>;
+                using WatchdogStore = util::TypeMap<WatchdogGroup, void, Stores>;
 
                 WatchdogServicer() : when(NUClear::clock::now()) {}
 
@@ -91,13 +95,15 @@ namespace dsl {
                  * @details
                  *  The watchdog timer for WatchdogGroup will have its service time updated to whatever is stored in
                  * when
+                 *
+                 * @param plant the slot of the PowerPlant the watchdog is in
                  */
-                void service() {
-                    if (WatchdogStore::get() == nullptr) {
+                void service(size_t plant) {
+                    if (WatchdogStore::get() == nullptr || WatchdogStore::get()->at(plant) == nullptr) {
                         throw std::runtime_error("Store for <" + util::demangle(typeid(WatchdogGroup).name())
                                                  + "> has not been created yet or no watchdog has been set up");
                     }
-                    WatchdogStore::set(std::make_shared<NUClear::clock::time_point>(when));
+                    WatchdogStore::get()->at(plant) = std::make_shared<NUClear::clock::time_point>(when);
                 }
 
             private:
@@ -152,9 +158,9 @@ namespace dsl {
             struct Watchdog {
 
                 template <typename WatchdogGroup, typename RuntimeType>
-                static void emit(PowerPlant&, WatchdogServicer<WatchdogGroup, RuntimeType>& servicer) {
+                static void emit(PowerPlant& powerplant, WatchdogServicer<WatchdogGroup, RuntimeType>& servicer) {
                     // Update our service time
-                    servicer.service();
+                    servicer.service(powerplant.id);
                 }
             };
 
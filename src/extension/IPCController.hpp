@@ -0,0 +1,157 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NUCLEAR_EXTENSION_IPCCONTROLLER_HPP
+#define NUCLEAR_EXTENSION_IPCCONTROLLER_HPP
+
+#include <map>
+#include <memory>
+#include <mutex>
+
+#include "../PowerPlant.hpp"
+#include "../Reactor.hpp"
+#include "ipc/SharedMemoryRing.hpp"
+
+namespace NUClear {
+namespace extension {
+
+    class IPCController : public Reactor {
+
+        using IPCListen = dsl::word::IPCListen;
+        using IPCEmit   = dsl::word::emit::IPCEmit;
+        using Unbind    = dsl::operation::Unbind<IPCListen>;
+
+    public:
+        explicit IPCController(std::unique_ptr<NUClear::Environment> environment) : Reactor(std::move(environment)) {
+
+            // Start listening for a new IPC type
+            on<Trigger<IPCListen>>().then("IPC Bind", [this](const IPCListen& l) {
+                std::lock_guard<std::mutex> lock(mutex);
+
+                // We only need a doorbell once something is listening
+                if (!doorbell) {
+                    doorbell = std::make_unique<ipc::Doorbell>();
+                    doorbell_handle =
+                        on<IO>(doorbell->fd(), IO::READ).then("IPC Receive", [this] { process(); });
+                }
+
+                auto& ring = get_ring(l.hash);
+                if (!ring.subscribed()) { ring.subscribe(doorbell->id()); }
+
+                reactions.insert(std::make_pair(l.hash, l.reaction));
+                deserialisers[l.hash] = l.deserialise;
+            });
+
+            // Stop listening for an IPC type
+            on<Trigger<Unbind>>().then("IPC Unbind", [this](const Unbind& unbind) {
+                std::lock_guard<std::mutex> lock(mutex);
+
+                // Find and delete this reaction
+                for (auto it = reactions.begin(); it != reactions.end(); ++it) {
+                    if (it->second->id == unbind.id) {
+                        reactions.erase(it);
+                        break;
+                    }
+                }
+            });
+
+            on<Trigger<IPCEmit>>().then("IPC Emit", [this](const IPCEmit& emit) {
+                // Messages that would need more than half of the ring are never sent
+                if (emit.size > ipc::SharedMemoryRing::max_payload()) {
+                    log<NUClear::ERROR>("Unable to emit a message of", emit.size, "bytes over IPC, the limit is",
+                                        ipc::SharedMemoryRing::max_payload());
+                    return;
+                }
+
+                ipc::SharedMemoryRing* ring = nullptr;
+                /* Mutex Scope */ {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    ring = &get_ring(emit.hash);
+                }
+
+                // Rings are never removed so we can write without holding the lock
+                ring->write(emit.size, emit.fill);
+            });
+        }
+
+    private:
+        ipc::SharedMemoryRing& get_ring(uint64_t hash) {
+            auto& ring = rings[hash];
+            if (!ring) { ring = std::make_unique<ipc::SharedMemoryRing>(hash); }
+            return *ring;
+        }
+
+        void process() {
+            std::lock_guard<std::mutex> lock(mutex);
+
+            doorbell->clear();
+
+            for (auto& r : rings) {
+                const uint64_t hash = r.first;
+
+                // Rings that we only write to have nothing to deserialise their messages
+                auto deserialise = deserialisers.find(hash);
+                if (deserialise == deserialisers.end()) { continue; }
+
+                r.second->read([this, hash, &deserialise](const ipc::SharedMemoryRing::Message& message) {
+                    dsl::word::IPCSource src;
+                    src.pid = message.pid;
+
+                    // Deserialise the message once, straight out of shared memory. If a writer started overwriting it
+                    // while we were doing that then what we have is garbage and the message is lost.
+                    dsl::word::IPCMessage data;
+                    data.data = deserialise->second(message.data, message.size);
+                    if (!message.intact()) { return; }
+
+                    // Store in our thread local cache
+                    dsl::store::ThreadStore<dsl::word::IPCMessage>::value = &data;
+                    dsl::store::ThreadStore<dsl::word::IPCSource>::value  = &src;
+
+                    // Execute on our interested reactions
+                    auto rs = reactions.equal_range(hash);
+                    for (auto it = rs.first; it != rs.second; ++it) {
+                        auto task = it->second->get_task();
+                        if (task) { powerplant.submit(std::move(task)); }
+                    }
+
+                    // Clear our cache
+                    dsl::store::ThreadStore<dsl::word::IPCMessage>::value = nullptr;
+                    dsl::store::ThreadStore<dsl::word::IPCSource>::value  = nullptr;
+                });
+            }
+        }
+
+        /// The socket that other processes use to wake us, made when the first IPC reaction is bound
+        std::unique_ptr<ipc::Doorbell> doorbell;
+        /// The reaction that reads from the rings when our doorbell rings
+        ReactionHandle doorbell_handle;
+
+        /// Mutex to guard the rings and reactions
+        std::mutex mutex;
+        /// The shared memory rings for each type hash we have read or written
+        std::map<uint64_t, std::unique_ptr<ipc::SharedMemoryRing>> rings;
+        /// Map of type hashes to reactions that are interested in them
+        std::multimap<uint64_t, std::shared_ptr<threading::Reaction>> reactions;
+        /// Map of type hashes to the function that deserialises their messages
+        std::map<uint64_t, std::function<std::shared_ptr<void>(const char*, size_t)>> deserialisers;
+    };
+
+}  // namespace extension
+}  // namespace NUClear
+
+#endif  // NUCLEAR_EXTENSION_IPCCONTROLLER_HPP
@@ -0,0 +1,60 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NUCLEAR_EXTENSION_LOGCONTROLLER_HPP
+#define NUCLEAR_EXTENSION_LOGCONTROLLER_HPP
+
+#include "../PowerPlant.hpp"
+#include "../Reactor.hpp"
+
+namespace NUClear {
+namespace extension {
+
+    /**
+     * @brief Formats and emits the log messages queued when PowerPlant::Configuration::async_logging is set.
+     *
+     * @details
+     *  The messages are emitted from this reactor's own thread, so the reactions that handle LogMessages run there
+     *  rather than in the reactions that logged. Anything still queued when the PowerPlant shuts down is emitted
+     *  during shutdown, and anything logged after that is emitted by PowerPlant::start once every thread has stopped.
+     */
+    class LogController : public Reactor {
+    public:
+        explicit LogController(std::unique_ptr<NUClear::Environment> environment) : Reactor(std::move(environment)) {
+
+            // Only run a consumer if we were asked to
+            if (powerplant.configuration.async_logging) {
+
+                on<Always>().then("Log Consumer", [this] {
+                    // Wake up every so often so we notice when the PowerPlant shuts down
+                    powerplant.logs.wait(std::chrono::milliseconds(100));
+                    powerplant.flush_logs();
+                });
+
+                on<Shutdown>().then("Log Flush", [this] {
+                    powerplant.logs.wake();
+                    powerplant.flush_logs();
+                });
+            }
+        }
+    };
+
+}  // namespace extension
+}  // namespace NUClear
+
+#endif  // NUCLEAR_EXTENSION_LOGCONTROLLER_HPP
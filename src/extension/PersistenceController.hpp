@@ -0,0 +1,237 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NUCLEAR_EXTENSION_PERSISTENCECONTROLLER_HPP
+#define NUCLEAR_EXTENSION_PERSISTENCECONTROLLER_HPP
+
+#include <cstdio>
+#include <fstream>
+#include <map>
+
+#include "../PowerPlant.hpp"
+#include "../Reactor.hpp"
+
+namespace NUClear {
+namespace extension {
+
+    class PersistenceController : public Reactor {
+
+        using PersistType              = dsl::word::PersistType;
+        using PersistenceConfiguration = message::PersistenceConfiguration;
+
+        /// The first bytes of every snapshot file
+        static constexpr char const* MAGIC = "NUCLEAR_SNAPSHOT";
+        /// The length of the magic, and the largest entry we are willing to read
+        enum : uint64_t { MAGIC_LENGTH = 16, MAX_ENTRY = uint64_t(1) << 32 };
+
+        struct Entry {
+            /// How to get at the data for this type
+            std::shared_ptr<const PersistType> type;
+            /// The data that was last serialised for this type
+            std::shared_ptr<const void> written;
+        };
+
+        /// A type and the data from the snapshot to restore it with
+        using Restore = std::pair<std::shared_ptr<const PersistType>, std::vector<char>>;
+
+    public:
+        explicit PersistenceController(std::unique_ptr<NUClear::Environment> environment)
+            : Reactor(std::move(environment)) {
+
+            on<Trigger<PersistType>>().then("Persist Bind", [this](std::shared_ptr<const PersistType> type) {
+                std::vector<Restore> pending;
+                std::string from;
+
+                /* Mutex Scope */ {
+                    std::lock_guard<std::mutex> lock(mutex);
+
+                    // Several reactions can persist the same type
+                    if (entries.count(type->hash) == 0) {
+                        entries[type->hash].type = type;
+
+                        // If we have already read a snapshot, this type can be restored now
+                        auto it = snapshot.find(type->hash);
+                        if (it != snapshot.end()) { pending.emplace_back(type, it->second); }
+                        from = path;
+                    }
+                }
+
+                restore(pending, from);
+            });
+
+            on<Trigger<PersistenceConfiguration>>().then(
+                "Persistence Configuration", [this](const PersistenceConfiguration& config) {
+                    // Stop writing to any previous snapshot
+                    if (write_handle) { write_handle.unbind(); }
+
+                    std::vector<Restore> pending;
+                    /* Mutex Scope */ {
+                        std::lock_guard<std::mutex> lock(mutex);
+
+                        path = config.path;
+                        snapshot.clear();
+                        for (auto& entry : entries) {
+                            entry.second.written.reset();
+                        }
+
+                        if (path.empty()) { return; }
+
+                        // Restore everything we know how to from the last snapshot
+                        read();
+                        for (auto& entry : entries) {
+                            auto it = snapshot.find(entry.first);
+                            if (it != snapshot.end()) { pending.emplace_back(entry.second.type, it->second); }
+                        }
+                    }
+
+                    restore(pending, config.path);
+
+                    write_handle = on<Every<0, NUClear::clock::duration>, Single>(config.period)
+                                       .then("Persistence Write", [this] {
+                                           std::lock_guard<std::mutex> lock(mutex);
+                                           write();
+                                       });
+                });
+
+            on<Shutdown>().then("Persistence Shutdown", [this] {
+                std::lock_guard<std::mutex> lock(mutex);
+                write();
+            });
+        }
+
+    private:
+        /**
+         * @brief Restores types from the snapshot, logging rather than throwing if one fails.
+         *
+         * @details This must be called without holding the mutex. Restoring emits the data directly, so reactions
+         *          run on this thread and may bind a Persist themselves, which takes the mutex.
+         *
+         * @param pending the types to restore and the data to restore them with
+         * @param from    the path of the snapshot the data was read from
+         */
+        void restore(const std::vector<Restore>& pending, const std::string& from) {
+            for (const auto& r : pending) {
+                try {
+                    r.first->restore(r.second);
+                }
+                catch (const std::exception& ex) {
+                    log<NUClear::WARN>("Unable to restore persisted data from", from, ex.what());
+                }
+            }
+        }
+
+        /// Reads the snapshot file into our snapshot map
+        void read() {
+            std::ifstream file(path, std::ios::binary);
+
+            // There is no snapshot yet, which is fine
+            if (!file) { return; }
+
+            char magic[MAGIC_LENGTH];
+            uint64_t count = 0;
+            file.read(magic, MAGIC_LENGTH);
+            file.read(reinterpret_cast<char*>(&count), sizeof(count));
+            if (!file || std::string(magic, MAGIC_LENGTH) != MAGIC) {
+                log<NUClear::WARN>("Ignoring", path, "as it is not a snapshot file");
+                return;
+            }
+
+            for (uint64_t i = 0; i < count; ++i) {
+                uint64_t hash = 0;
+                uint64_t size = 0;
+                file.read(reinterpret_cast<char*>(&hash), sizeof(hash));
+                file.read(reinterpret_cast<char*>(&size), sizeof(size));
+                if (!file || size > MAX_ENTRY) { break; }
+
+                std::vector<char> payload(size);
+                file.read(payload.data(), size);
+                if (!file) { break; }
+
+                snapshot[hash] = std::move(payload);
+            }
+
+            if (!file) { log<NUClear::WARN>("The snapshot", path, "was truncated"); }
+        }
+
+        /// Writes the snapshot file if any of the persisted data has changed since it was last written
+        void write() {
+            if (path.empty()) { return; }
+
+            bool changed = false;
+            for (auto& entry : entries) {
+                auto latest = entry.second.type->latest();
+                if (latest && latest != entry.second.written) {
+                    try {
+                        snapshot[entry.first] = entry.second.type->serialise(latest);
+                        entry.second.written  = latest;
+                        changed               = true;
+                    }
+                    catch (const std::exception& ex) {
+                        log<NUClear::WARN>("Unable to serialise persisted data for", path, ex.what());
+                    }
+                }
+            }
+            if (!changed) { return; }
+
+            // Write to a temporary file and swap it in so a crash never leaves a partial snapshot behind
+            std::string temp = path + ".tmp";
+            /* File Scope */ {
+                std::ofstream file(temp, std::ios::binary | std::ios::trunc);
+
+                uint64_t count = snapshot.size();
+                file.write(MAGIC, MAGIC_LENGTH);
+                file.write(reinterpret_cast<const char*>(&count), sizeof(count));
+                for (const auto& s : snapshot) {
+                    uint64_t size = s.second.size();
+                    file.write(reinterpret_cast<const char*>(&s.first), sizeof(s.first));
+                    file.write(reinterpret_cast<const char*>(&size), sizeof(size));
+                    file.write(s.second.data(), size);
+                }
+
+                if (!file.flush()) {
+                    log<NUClear::WARN>("Unable to write the snapshot", temp);
+                    return;
+                }
+            }
+
+            // Windows will not rename over an existing file
+            if (std::rename(temp.c_str(), path.c_str()) != 0) {
+                std::remove(path.c_str());
+                if (std::rename(temp.c_str(), path.c_str()) != 0) {
+                    log<NUClear::WARN>("Unable to replace the snapshot", path);
+                }
+            }
+        }
+
+        /// The path of the snapshot file, empty if persistence is not configured
+        std::string path;
+        /// The reaction that periodically writes the snapshot
+        ReactionHandle write_handle;
+
+        /// Mutex to guard the entries and the snapshot
+        std::mutex mutex;
+        /// Map of type hashes to the types that are persisted
+        std::map<uint64_t, Entry> entries;
+        /// Map of type hashes to their serialised data, as read from or written to the snapshot file
+        std::map<uint64_t, std::vector<char>> snapshot;
+    };
+
+}  // namespace extension
+}  // namespace NUClear
+
+#endif  // NUCLEAR_EXTENSION_PERSISTENCECONTROLLER_HPP
@@ -0,0 +1,50 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NUCLEAR_EXTENSION_STATISTICSCONTROLLER_HPP
+#define NUCLEAR_EXTENSION_STATISTICSCONTROLLER_HPP
+
+#include "../PowerPlant.hpp"
+#include "../Reactor.hpp"
+#include "../util/LockProfiler.hpp"
+
+namespace NUClear {
+namespace extension {
+
+    class StatisticsController : public Reactor {
+    public:
+        explicit StatisticsController(std::unique_ptr<NUClear::Environment> environment)
+            : Reactor(std::move(environment)) {
+
+            // Only summarise if we were asked to
+            if (powerplant.configuration.statistics_period > clock::duration(0)) {
+                on<Every<0, NUClear::clock::duration>, Single>(powerplant.configuration.statistics_period)
+                    .then("Statistics Summary", [this] { emit(powerplant.statistics.summarise()); });
+
+#ifdef NUCLEAR_PROFILE_LOCKS
+                on<Every<0, NUClear::clock::duration>, Single>(powerplant.configuration.statistics_period)
+                    .then("Lock Statistics", [this] { emit(util::LockProfiler::summarise()); });
+#endif
+            }
+        }
+    };
+
+}  // namespace extension
+}  // namespace NUClear
+
+#endif  // NUCLEAR_EXTENSION_STATISTICSCONTROLLER_HPP
@@ -0,0 +1,251 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NUCLEAR_EXTENSION_TRACECONTROLLER_HPP
+#define NUCLEAR_EXTENSION_TRACECONTROLLER_HPP
+
+#include <fstream>
+#include <map>
+
+#include "../PowerPlant.hpp"
+#include "../Reactor.hpp"
+
+namespace NUClear {
+namespace extension {
+
+    class TraceController : public Reactor {
+
+        using ReactionStatistics = message::ReactionStatistics;
+        using TraceConfiguration = message::TraceConfiguration;
+
+        struct Event {
+            message::ReactionIdentifier identifier;
+            uint64_t reaction_id;
+            uint64_t task_id;
+            uint64_t cause_task_id;
+            clock::time_point emitted;
+            clock::time_point started;
+            clock::time_point finished;
+            bool exception;
+        };
+
+        /// The ring of recent events of one thread
+        struct Track {
+            Track(size_t id, std::thread::id thread) : id(id), thread(thread), capacity(0), next(0) {}
+
+            /// Held while recording, and while clearing or writing the trace
+            std::mutex mutex;
+            /// The id of this track in the trace
+            const size_t id;
+            /// The thread this track records
+            const std::thread::id thread;
+            /// The most events to keep
+            size_t capacity;
+            /// Where the next event goes once the ring is full
+            size_t next;
+            /// The recorded events
+            std::vector<Event> events;
+        };
+
+    public:
+        explicit TraceController(std::unique_ptr<NUClear::Environment> environment)
+            : Reactor(std::move(environment)), serial(++serial_source()), capacity(0) {
+
+            record_handle = on<Trigger<ReactionStatistics>>().then(
+                "Trace Record", [this](const ReactionStatistics& stats) {
+                    Track& t = track();
+                    std::lock_guard<std::mutex> lock(t.mutex);
+
+                    if (t.capacity == 0) { return; }
+
+                    Event e{stats.identifier,
+                            stats.reaction_id,
+                            stats.task_id,
+                            stats.cause_task_id,
+                            stats.emitted,
+                            stats.started,
+                            stats.finished,
+                            bool(stats.exception)};
+
+                    if (t.events.size() < t.capacity) { t.events.push_back(e); }
+                    else {
+                        t.events[t.next] = e;
+                        t.next           = (t.next + 1) % t.capacity;
+                    }
+                });
+            record_handle.disable();
+
+            on<Trigger<TraceConfiguration>>().then("Trace Configuration", [this](const TraceConfiguration& config) {
+                // Stop recording and write out what we have
+                record_handle.disable();
+                write();
+
+                std::lock_guard<std::mutex> lock(mutex);
+                path     = config.path;
+                capacity = config.path.empty() ? 0 : config.events_per_thread;
+                for (auto& t : tracks) {
+                    std::lock_guard<std::mutex> track_lock(t->mutex);
+                    t->capacity = capacity;
+                    t->next     = 0;
+                    t->events.clear();
+                }
+
+                if (capacity > 0) { record_handle.enable(); }
+            });
+
+            on<Shutdown>().then("Trace Shutdown", [this] {
+                record_handle.disable();
+                write();
+            });
+        }
+
+    private:
+        static std::atomic<uint64_t>& serial_source() {
+            static std::atomic<uint64_t> source(0);
+            return source;
+        }
+
+        /// Gets the track of the calling thread, creating it the first time
+        Track& track() {
+            // The tracks this thread has for each controller, there is normally only one
+            thread_local std::vector<std::pair<uint64_t, std::shared_ptr<Track>>> cache;
+
+            for (auto& c : cache) {
+                if (c.first == serial) { return *c.second; }
+            }
+
+            std::shared_ptr<Track> t;
+            /* Mutex Scope */ {
+                std::lock_guard<std::mutex> lock(mutex);
+                t           = std::make_shared<Track>(tracks.size() + 1, std::this_thread::get_id());
+                t->capacity = capacity;
+                tracks.push_back(t);
+            }
+            cache.emplace_back(serial, t);
+            return *t;
+        }
+
+        static std::string escape(const std::string& str) {
+            std::string out;
+            for (char c : str) {
+                if (c == '"' || c == '\\') {
+                    out.push_back('\\');
+                    out.push_back(c);
+                }
+                else if (static_cast<unsigned char>(c) < 0x20) {
+                    out.push_back(' ');
+                }
+                else {
+                    out.push_back(c);
+                }
+            }
+            return out;
+        }
+
+        /// Writes the recorded events to the trace file
+        void write() {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (path.empty()) { return; }
+
+            // Gather every event along with the track it happened on
+            std::vector<std::pair<size_t, Event>> events;
+            for (auto& t : tracks) {
+                std::lock_guard<std::mutex> track_lock(t->mutex);
+                for (auto& e : t->events) {
+                    events.emplace_back(t->id, e);
+                }
+            }
+            if (events.empty()) { return; }
+
+            std::map<uint64_t, std::pair<size_t, clock::time_point>> causes;
+            clock::time_point epoch = events.front().second.emitted;
+            for (auto& e : events) {
+                causes[e.second.task_id] = std::make_pair(e.first, e.second.started);
+                epoch                    = std::min(epoch, e.second.emitted);
+            }
+            auto us = [epoch](const clock::time_point& t) {
+                return std::chrono::duration<double, std::micro>(t - epoch).count();
+            };
+
+            std::ofstream file(path);
+            file << std::fixed << "{\"traceEvents\":[";
+
+            bool first = true;
+            auto next  = [&]() -> std::ofstream& {
+                file << (first ? "\n" : ",\n");
+                first = false;
+                return file;
+            };
+
+            const size_t pid = powerplant.id;
+            for (auto& t : tracks) {
+                std::string name = t->thread == powerplant.main_thread_id ? "Main Thread"
+                                                                          : "Thread " + std::to_string(t->id);
+                next() << R"({"ph":"M","name":"thread_name","pid":)" << pid << R"(,"tid":)" << t->id
+                       << R"(,"args":{"name":")" << name << R"("}})";
+            }
+
+            for (auto& pair : events) {
+                const size_t tid = pair.first;
+                const Event& e   = pair.second;
+
+                const auto& id   = e.identifier;
+                std::string name = id.size() < 4 ? "" : !id[0].empty() ? id[0] : id[1] + " " + id[2];
+
+                next() << R"({"ph":"X","name":")" << escape(name) << R"(","cat":")"
+                       << escape(id.size() < 2 ? "" : id[1]) << R"(","pid":)" << pid << R"(,"tid":)" << tid
+                       << R"(,"ts":)" << us(e.started) << R"(,"dur":)" << us(e.finished) - us(e.started)
+                       << R"(,"args":{"reaction_id":)" << e.reaction_id << R"(,"task_id":)" << e.task_id
+                       << R"(,"wait_us":)" << us(e.started) - us(e.emitted) << R"(,"exception":)"
+                       << (e.exception ? "true" : "false") << "}}";
+
+                // Draw an arrow from the task that emitted this one, if we still have it
+                auto cause = causes.find(e.cause_task_id);
+                if (cause != causes.end()) {
+                    clock::time_point from = std::max(e.emitted, cause->second.second);
+                    next() << R"({"ph":"s","name":"cause","cat":"flow","id":)" << e.task_id << R"(,"pid":)" << pid
+                           << R"(,"tid":)" << cause->second.first << R"(,"ts":)" << us(from) << "}";
+                    next() << R"({"ph":"f","bp":"e","name":"cause","cat":"flow","id":)" << e.task_id
+                           << R"(,"pid":)" << pid << R"(,"tid":)" << tid << R"(,"ts":)" << us(e.started) << "}";
+                }
+            }
+
+            file << "\n]}\n";
+
+            if (!file) { log<NUClear::WARN>("Unable to write the trace", path); }
+        }
+
+        /// Tells apart the tracks of different controllers in each thread's cache
+        const uint64_t serial;
+        /// The reaction that records statistics while tracing
+        ReactionHandle record_handle;
+
+        /// Guards the tracks, path and capacity
+        std::mutex mutex;
+        /// The file the trace is written to, empty if we are not recording
+        std::string path;
+        /// The number of events each track keeps
+        size_t capacity;
+        /// The track of every thread that has recorded statistics
+        std::vector<std::shared_ptr<Track>> tracks;
+    };
+
+}  // namespace extension
+}  // namespace NUClear
+
+#endif  // NUCLEAR_EXTENSION_TRACECONTROLLER_HPP
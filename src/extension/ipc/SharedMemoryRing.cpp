@@ -0,0 +1,556 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "SharedMemoryRing.hpp"
+
+#include <stdexcept>
+#include <system_error>
+
+#ifndef _WIN32
+
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/socket.h>
+#    include <sys/stat.h>
+#    include <sys/un.h>
+#    include <unistd.h>
+
+#    include <algorithm>
+#    include <array>
+#    include <atomic>
+#    include <chrono>
+#    include <cstring>
+#    include <exception>
+#    include <new>
+#    include <sstream>
+#    include <thread>
+
+namespace NUClear {
+namespace extension {
+    namespace ipc {
+
+        namespace {
+            /// Identifies a segment as a NUClear ring
+            constexpr uint32_t ring_magic = 0x4e554950;
+            /// Changes whenever the layout of the segment changes, it is part of the name of the segment
+            constexpr uint32_t ring_version = 2;
+            /// The number of slots a ring holds before the oldest is overwritten
+            constexpr uint64_t slot_count = 64;
+            /// The size of the payload area of each slot, this must be a multiple of the page size
+            constexpr uint64_t slot_size = 256 * 1024;
+            /// The most slots that one message can use, so that a single message can't lap the ring by itself
+            constexpr uint64_t max_parts = slot_count / 2;
+            /// The number of readers that can be reading a ring at the same time
+            constexpr size_t max_readers = 32;
+            /// How long to wait for another process to finish creating or removing a segment
+            constexpr auto create_timeout = std::chrono::seconds(1);
+            /// How long a writer can hold a slot before other writers assume that it has died and take the slot
+            constexpr auto claim_timeout = std::chrono::milliseconds(100);
+
+            std::string doorbell_path(uint64_t id) {
+                std::stringstream path;
+                path << "/tmp/nuclear_ipc_" << (id >> 32) << "_" << (id & 0xFFFFFFFF);
+                return path.str();
+            }
+
+            sockaddr_un doorbell_address(uint64_t id) {
+                sockaddr_un address{};
+                address.sun_family = AF_UNIX;
+                std::strncpy(address.sun_path, doorbell_path(id).c_str(), sizeof(address.sun_path) - 1);
+                return address;
+            }
+        }  // namespace
+
+        struct SharedMemoryRing::Header {
+            struct Reader {
+                /// The doorbell id of the reader using this entry, or 0 if it is free
+                std::atomic<uint64_t> id;
+                /// Set when the reader has run out of messages and wants its doorbell rung
+                std::atomic<uint32_t> waiting;
+            };
+
+            /// Set to ring_magic once the process that created the segment has finished setting it up
+            std::atomic<uint32_t> magic;
+            uint32_t version;
+            uint64_t slot_count;
+            uint64_t slot_size;
+            /// The number of processes that have the segment open, the last one to close it removes it
+            std::atomic<uint32_t> attached;
+
+            /// The index of the next message to be written
+            alignas(64) std::atomic<uint64_t> write_index;
+            /// The processes that are reading from this ring
+            alignas(64) std::array<Reader, max_readers> readers;
+        };
+
+        struct alignas(64) SharedMemoryRing::Slot {
+            /// 2 * index + 1 while message index is being written, and 2 * index + 2 once it is complete
+            std::atomic<uint64_t> sequence;
+            /// The size of the whole message, this is only set in the first slot of a message
+            uint64_t size;
+            /// The number of slots the message uses, this is zero for every slot but the first
+            uint64_t parts;
+            /// The process that wrote the message
+            int32_t pid;
+        };
+
+        Doorbell::Doorbell() : reader_id(0), socket_fd(-1) {
+
+            // Several powerplants in one process each need their own doorbell
+            static std::atomic<uint32_t> instances(0);
+            reader_id = (uint64_t(uint32_t(::getpid())) << 32) | ++instances;
+
+            socket_fd = ::socket(AF_UNIX, SOCK_DGRAM, 0);
+            if (socket_fd < 0) {
+                throw std::system_error(errno, std::system_category(), "Unable to open the IPC doorbell socket");
+            }
+            ::fcntl(socket_fd, F_SETFL, ::fcntl(socket_fd, F_GETFL) | O_NONBLOCK);
+
+            // A crashed process with our pid may have left its doorbell behind
+            sockaddr_un address = doorbell_address(reader_id);
+            ::unlink(address.sun_path);
+
+            if (::bind(socket_fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) < 0) {
+                ::close(socket_fd);
+                throw std::system_error(errno, std::system_category(), "Unable to bind the IPC doorbell socket");
+            }
+        }
+
+        Doorbell::~Doorbell() {
+            ::close(socket_fd);
+            ::unlink(doorbell_path(reader_id).c_str());
+        }
+
+        uint64_t Doorbell::id() const {
+            return reader_id;
+        }
+
+        fd_t Doorbell::fd() const {
+            return socket_fd;
+        }
+
+        void Doorbell::clear() {
+            char buffer[64];
+            while (::recv(socket_fd, buffer, sizeof(buffer), 0) > 0) {
+            }
+        }
+
+        bool Doorbell::ring(uint64_t id) {
+
+            // One unbound socket can send to every doorbell
+            static const int sender = ::socket(AF_UNIX, SOCK_DGRAM, 0);
+
+            sockaddr_un address = doorbell_address(id);
+            char ding           = 0;
+            if (::sendto(sender,
+                         &ding,
+                         sizeof(ding),
+                         MSG_DONTWAIT,
+                         reinterpret_cast<sockaddr*>(&address),
+                         sizeof(address))
+                < 0) {
+                // A full socket already has a ring waiting in it, anything else means the reader is gone
+                return errno == EAGAIN || errno == EWOULDBLOCK;
+            }
+            return true;
+        }
+
+        SharedMemoryRing::Message::Message(SharedMemoryRing& ring, uint64_t index, uint64_t parts)
+            : pid(0), data(nullptr), size(0), ring(ring), index(index), parts(parts) {}
+
+        bool SharedMemoryRing::Message::intact() const {
+
+            // A writer claims a slot before it touches the payload, so if every slot still has our sequence number
+            // then nothing has written over what was read
+            std::atomic_thread_fence(std::memory_order_acquire);
+            for (uint64_t i = index; i < index + parts; ++i) {
+                if (ring.slot(i).sequence.load(std::memory_order_relaxed) != i * 2 + 2) { return false; }
+            }
+            return true;
+        }
+
+        size_t SharedMemoryRing::max_payload() {
+            return slot_size * max_parts;
+        }
+
+        std::string SharedMemoryRing::segment_name(uint64_t hash) {
+            std::stringstream ss;
+            ss << "/nuclear_ipc" << ring_version << "_" << std::hex << hash;
+            return ss.str();
+        }
+
+        SharedMemoryRing::SharedMemoryRing(uint64_t hash)
+            : name(segment_name(hash))
+            , fd(-1)
+            , header_length(0)
+            , data_length(slot_count * slot_size)
+            , header(nullptr)
+            , reader_index(-1)
+            , next(0) {
+
+            // The payloads must start on a page boundary so that they can be mapped a second time
+            const size_t page = size_t(::sysconf(_SC_PAGESIZE));
+            header_length     = (sizeof(Header) + slot_count * sizeof(Slot) + page - 1) / page * page;
+
+            // If the last process to use the segment was removing it as we opened it, we have to open it again
+            auto deadline = std::chrono::steady_clock::now() + create_timeout;
+            while (!attach()) {
+                if (std::chrono::steady_clock::now() > deadline) {
+                    throw std::runtime_error("The IPC segment " + name + " was never removed");
+                }
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+        }
+
+        bool SharedMemoryRing::attach() {
+
+            const size_t length = header_length + data_length;
+
+            // Try to be the process that creates the segment, otherwise open the one that is there
+            fd           = ::shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0666);
+            bool creator = fd >= 0;
+            if (!creator && errno == EEXIST) { fd = ::shm_open(name.c_str(), O_RDWR, 0666); }
+            if (fd < 0) {
+                // The segment was removed between us failing to create it and opening it
+                if (errno == ENOENT) { return false; }
+                throw std::system_error(errno, std::system_category(), "Unable to open the IPC segment " + name);
+            }
+
+            // The creator sizes the segment, everyone else has to wait for it to be big enough to map
+            auto deadline = std::chrono::steady_clock::now() + create_timeout;
+            if (creator) {
+                if (::ftruncate(fd, off_t(length)) < 0) {
+                    ::close(fd);
+                    throw std::system_error(errno, std::system_category(), "Unable to size the IPC segment " + name);
+                }
+            }
+            else {
+                struct stat info {};
+                while (::fstat(fd, &info) == 0 && size_t(info.st_size) < length) {
+                    if (std::chrono::steady_clock::now() > deadline) {
+                        ::close(fd);
+                        throw std::runtime_error("The IPC segment " + name + " was never set up");
+                    }
+                    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                }
+            }
+
+            // Reserve enough address space for the segment followed by a second copy of the payloads, then map the
+            // segment over it. This way a message that wraps around the end of the ring is still contiguous.
+            void* base = ::mmap(nullptr, length + data_length, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (base == MAP_FAILED) {
+                ::close(fd);
+                throw std::system_error(errno, std::system_category(), "Unable to map the IPC segment " + name);
+            }
+            char* memory = static_cast<char*>(base);
+            if (::mmap(memory, length, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) == MAP_FAILED
+                || ::mmap(memory + length,
+                          data_length,
+                          PROT_READ | PROT_WRITE,
+                          MAP_SHARED | MAP_FIXED,
+                          fd,
+                          off_t(header_length))
+                       == MAP_FAILED) {
+                int error = errno;
+                ::munmap(base, length + data_length);
+                ::close(fd);
+                throw std::system_error(error, std::system_category(), "Unable to map the IPC segment " + name);
+            }
+
+            if (creator) {
+                header             = new (memory) Header();
+                header->version    = ring_version;
+                header->slot_count = slot_count;
+                header->slot_size  = slot_size;
+                header->attached.store(1);
+                header->magic.store(ring_magic);
+                return true;
+            }
+
+            header = reinterpret_cast<Header*>(memory);
+            while (header->magic.load() != ring_magic) {
+                if (std::chrono::steady_clock::now() > deadline) {
+                    ::munmap(base, length + data_length);
+                    ::close(fd);
+                    throw std::runtime_error("The IPC segment " + name + " was never set up");
+                }
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+
+            if (header->version != ring_version || header->slot_count != slot_count
+                || header->slot_size != slot_size) {
+                ::munmap(base, length + data_length);
+                ::close(fd);
+                throw std::runtime_error("The IPC segment " + name + " was made by an incompatible version of NUClear");
+            }
+
+            // Count ourselves as using the segment, unless the last process to use it has already started removing it
+            uint32_t attached = header->attached.load();
+            do {
+                if (attached == 0) {
+                    ::munmap(base, length + data_length);
+                    ::close(fd);
+                    header = nullptr;
+                    fd     = -1;
+                    return false;
+                }
+            } while (!header->attached.compare_exchange_weak(attached, attached + 1));
+
+            return true;
+        }
+
+        SharedMemoryRing::~SharedMemoryRing() {
+
+            // Give up our place in the reader table
+            if (reader_index >= 0) { header->readers[reader_index].id.store(0); }
+
+            // The last process to close the segment removes it
+            if (header->attached.fetch_sub(1) == 1) { ::shm_unlink(name.c_str()); }
+
+            ::munmap(header, header_length + 2 * data_length);
+            ::close(fd);
+        }
+
+        SharedMemoryRing::Slot& SharedMemoryRing::slot(uint64_t index) {
+            Slot* slots = reinterpret_cast<Slot*>(reinterpret_cast<char*>(header) + sizeof(Header));
+            return slots[index % slot_count];
+        }
+
+        char* SharedMemoryRing::payload(uint64_t index) {
+            return reinterpret_cast<char*>(header) + header_length + (index % slot_count) * slot_size;
+        }
+
+        bool SharedMemoryRing::claim(uint64_t index) {
+
+            Slot& s                = slot(index);
+            const uint64_t claimed = index * 2 + 1;
+            uint64_t sequence      = s.sequence.load();
+            std::chrono::steady_clock::time_point deadline;
+
+            for (;;) {
+                // A writer with a newer message already has the slot, our message was lapped before we could write it
+                if (sequence >= claimed) { return false; }
+
+                // An older writer is still writing into this slot, wait for it unless it has died part way through
+                if (sequence % 2 == 1) {
+                    auto now = std::chrono::steady_clock::now();
+                    if (deadline == std::chrono::steady_clock::time_point()) { deadline = now + claim_timeout; }
+                    if (now < deadline) {
+                        std::this_thread::yield();
+                        sequence = s.sequence.load();
+                        continue;
+                    }
+                }
+
+                if (s.sequence.compare_exchange_weak(sequence, claimed)) { return true; }
+            }
+        }
+
+        bool SharedMemoryRing::publish(uint64_t index) {
+            uint64_t claimed = index * 2 + 1;
+            return slot(index).sequence.compare_exchange_strong(claimed, index * 2 + 2);
+        }
+
+        void SharedMemoryRing::write(size_t size, const std::function<void(char*)>& fill) {
+
+            if (size > max_payload()) { throw std::length_error("The message is too large to send over IPC"); }
+
+            const uint64_t parts = std::max<uint64_t>(1, (size + slot_size - 1) / slot_size);
+            const uint64_t index = header->write_index.fetch_add(parts);
+
+            // Claim every slot of the message before we touch any of them
+            uint64_t claimed = 0;
+            while (claimed < parts && claim(index + claimed)) {
+                ++claimed;
+            }
+            std::atomic_thread_fence(std::memory_order_release);
+
+            // If we were lapped before we could claim every slot, or the message could not be written, it is lost and
+            // the slots we did claim are published as empty so readers skip them
+            bool complete = claimed == parts;
+            std::exception_ptr failed;
+            if (complete) {
+                try {
+                    fill(payload(index));
+                }
+                catch (...) {
+                    failed   = std::current_exception();
+                    complete = false;
+                }
+            }
+
+            // Publish the rest of the message first, so that once a reader sees the first slot all of it is there
+            for (uint64_t i = claimed; i > 1; --i) {
+                slot(index + i - 1).parts = 0;
+                publish(index + i - 1);
+            }
+
+            if (claimed > 0) {
+                Slot& s = slot(index);
+                s.size  = complete ? size : 0;
+                s.parts = complete ? parts : 0;
+                s.pid   = ::getpid();
+
+                // This and the load of waiting are sequentially consistent with the reader going to sleep so either it
+                // sees this message, or we see that it is waiting
+                publish(index);
+            }
+
+            if (failed) { std::rethrow_exception(failed); }
+            if (!complete) { return; }
+
+            for (auto& reader : header->readers) {
+                if (reader.waiting.load() != 0 && reader.waiting.exchange(0) != 0) {
+                    uint64_t id = reader.id.load();
+
+                    // Free the entry of any reader that has gone away without cleaning up
+                    if (id != 0 && !Doorbell::ring(id)) { reader.id.compare_exchange_strong(id, 0); }
+                }
+            }
+        }
+
+        void SharedMemoryRing::subscribe(uint64_t reader) {
+
+            for (size_t i = 0; i < max_readers; ++i) {
+                uint64_t expected = 0;
+                if (header->readers[i].id.compare_exchange_strong(expected, reader)) {
+                    reader_index = int(i);
+                    next         = header->write_index.load();
+                    header->readers[i].waiting.store(1);
+                    return;
+                }
+            }
+
+            throw std::runtime_error("There are too many processes reading from the IPC segment " + name);
+        }
+
+        bool SharedMemoryRing::subscribed() const {
+            return reader_index >= 0;
+        }
+
+        void SharedMemoryRing::drain(const std::function<void(const Message&)>& callback) {
+
+            for (;;) {
+                Slot& s                 = slot(next);
+                const uint64_t expected = next * 2 + 2;
+                const uint64_t sequence = s.sequence.load(std::memory_order_acquire);
+
+                if (sequence < expected) {
+                    // Normally this is the end of the messages, unless the writer of this slot died part way through
+                    if (header->write_index.load() <= next + slot_count) { return; }
+                    ++next;
+                    continue;
+                }
+
+                // We have been lapped, skip to the oldest message that is still in the ring
+                if (sequence > expected) {
+                    next = std::max(next + 1, header->write_index.load() - slot_count);
+                    continue;
+                }
+
+                Message message(*this, next, s.parts);
+                message.pid  = s.pid;
+                message.size = s.size;
+                message.data = payload(next);
+
+                // If the slot was reused while we were reading its header then go around again
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if (s.sequence.load(std::memory_order_relaxed) != expected) { continue; }
+
+                // This is the rest of a message we skipped, or a message that was lost when its writer was lapped
+                if (message.parts == 0) {
+                    ++next;
+                    continue;
+                }
+
+                next += message.parts;
+                callback(message);
+            }
+        }
+
+        void SharedMemoryRing::read(const std::function<void(const Message&)>& callback) {
+
+            if (reader_index < 0) { return; }
+            auto& reader = header->readers[reader_index];
+
+            for (;;) {
+                drain(callback);
+
+                // Go to sleep, unless a message arrived before the writer could see that we were waiting
+                reader.waiting.store(1);
+                if (slot(next).sequence.load() < next * 2 + 2) { return; }
+                reader.waiting.store(0);
+            }
+        }
+
+    }  // namespace ipc
+}  // namespace extension
+}  // namespace NUClear
+
+#else  // _WIN32
+
+namespace NUClear {
+namespace extension {
+    namespace ipc {
+
+        // Shared memory IPC is only implemented for POSIX systems
+
+        Doorbell::Doorbell() : reader_id(0), socket_fd(INVALID_SOCKET) {
+            throw std::runtime_error("IPC is not supported on this platform");
+        }
+        Doorbell::~Doorbell() = default;
+        uint64_t Doorbell::id() const {
+            return reader_id;
+        }
+        fd_t Doorbell::fd() const {
+            return socket_fd;
+        }
+        void Doorbell::clear() {}
+        bool Doorbell::ring(uint64_t) {
+            return false;
+        }
+
+        SharedMemoryRing::Message::Message(SharedMemoryRing& ring, uint64_t index, uint64_t parts)
+            : pid(0), data(nullptr), size(0), ring(ring), index(index), parts(parts) {}
+        bool SharedMemoryRing::Message::intact() const {
+            return false;
+        }
+
+        size_t SharedMemoryRing::max_payload() {
+            return 0;
+        }
+        std::string SharedMemoryRing::segment_name(uint64_t) {
+            return std::string();
+        }
+        SharedMemoryRing::SharedMemoryRing(uint64_t)
+            : name(), fd(-1), header_length(0), data_length(0), header(nullptr), reader_index(-1), next(0) {
+            throw std::runtime_error("IPC is not supported on this platform");
+        }
+        SharedMemoryRing::~SharedMemoryRing() = default;
+        void SharedMemoryRing::write(size_t, const std::function<void(char*)>&) {}
+        void SharedMemoryRing::subscribe(uint64_t) {}
+        bool SharedMemoryRing::subscribed() const {
+            return false;
+        }
+        void SharedMemoryRing::read(const std::function<void(const Message&)>&) {}
+
+    }  // namespace ipc
+}  // namespace extension
+}  // namespace NUClear
+
+#endif  // _WIN32
@@ -0,0 +1,222 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NUCLEAR_EXTENSION_IPC_SHAREDMEMORYRING_HPP
+#define NUCLEAR_EXTENSION_IPC_SHAREDMEMORYRING_HPP
+
+#include <cstdint>
+#include <functional>
+#include <string>
+
+#include "../../util/platform.hpp"
+
+namespace NUClear {
+namespace extension {
+    namespace ipc {
+
+        /**
+         * @brief A socket that other processes poke when they write to a ring that we are reading.
+         *
+         * @details Each reader has a unix datagram socket bound to a path made from its reader id. The socket is only
+         *          used as a wakeup, so it can be waited on by the IOController like any other file descriptor.
+         */
+        class Doorbell {
+        public:
+            /**
+             * @brief Makes a new doorbell with a reader id that is unique on this host.
+             */
+            Doorbell();
+            ~Doorbell();
+
+            Doorbell(const Doorbell&)            = delete;
+            Doorbell& operator=(const Doorbell&) = delete;
+
+            /// @brief The id that writers use to find this doorbell
+            uint64_t id() const;
+
+            /// @brief The file descriptor that becomes readable when the doorbell is rung
+            fd_t fd() const;
+
+            /**
+             * @brief Throws away any pending rings so the file descriptor is no longer readable.
+             */
+            void clear();
+
+            /**
+             * @brief Rings the doorbell of a reader.
+             *
+             * @param id the id of the reader to wake
+             *
+             * @return false if there is no longer a reader with that id
+             */
+            static bool ring(uint64_t id);
+
+        private:
+            /// The id of this doorbell, the pid of the process in the upper 32 bits
+            uint64_t reader_id;
+            /// The socket that receives the rings
+            fd_t socket_fd;
+        };
+
+        /**
+         * @brief A ring of messages in shared memory that any number of processes can write to and read from.
+         *
+         * @details Each message type has its own named shared memory segment which holds a fixed number of fixed
+         *          size slots. A message that is larger than a slot uses several slots in a row. Writers reserve the
+         *          slots for a message with an atomic increment, and then claim each one by swapping its sequence
+         *          number to an odd value. This means two writers that have lapped the ring can never write into the
+         *          same slot at the same time. The payload is serialised straight into the slots, and the payload
+         *          area is mapped twice in a row so that a message that wraps around the end of the ring is still
+         *          contiguous. Readers deserialise straight out of the slots, so a message is copied once on the way
+         *          in and once on the way out. As the sequence numbers change when a slot is reused, readers can tell
+         *          if a message was overwritten while they were reading it.
+         *
+         *          The ring never blocks writers. If a reader falls more than a full ring behind it will skip the
+         *          messages that were overwritten, in the same way that it would lose packets over UDP.
+         *
+         *          Readers register themselves in the segment with the id of their Doorbell. When a reader runs out
+         *          of messages it marks itself as waiting, and the next writer to see that flag rings its doorbell.
+         *          This way a steady stream of messages only costs a wakeup when the reader was idle.
+         *
+         *          The segment counts the processes that have it open, and the last one to close it removes it.
+         *          A process that crashes can't do this, so its segments are left behind in /dev/shm until they are
+         *          deleted by hand (they are named nuclear_ipc followed by the version of the layout and the type).
+         */
+        class SharedMemoryRing {
+        public:
+            /**
+             * @brief A message that is being read straight out of a ring.
+             */
+            class Message {
+            public:
+                /// @brief The process that wrote the message
+                int32_t pid;
+                /// @brief The payload of the message, it points into shared memory and is only valid during the read
+                const char* data;
+                /// @brief The size of the payload in bytes
+                size_t size;
+
+                /**
+                 * @brief Checks that no writer has started overwriting this message.
+                 *
+                 * @details Anything read from the payload must be thrown away unless this is true after it was read.
+                 *
+                 * @return true if the message is still intact
+                 */
+                bool intact() const;
+
+            private:
+                friend class SharedMemoryRing;
+                Message(SharedMemoryRing& ring, uint64_t index, uint64_t parts);
+
+                /// The ring that the message is in
+                SharedMemoryRing& ring;
+                /// The index of the first slot of the message
+                uint64_t index;
+                /// The number of slots the message uses
+                uint64_t parts;
+            };
+
+            /// @brief The largest payload that can be written into the ring
+            static size_t max_payload();
+
+            /**
+             * @brief Gets the name of the shared memory segment for a message type.
+             *
+             * @param hash the hash of the message type (from util::serialise::Serialise)
+             */
+            static std::string segment_name(uint64_t hash);
+
+            /**
+             * @brief Opens the ring for a message type, creating it if no other process has yet.
+             *
+             * @param hash the hash of the message type (from util::serialise::Serialise)
+             */
+            explicit SharedMemoryRing(uint64_t hash);
+            ~SharedMemoryRing();
+
+            SharedMemoryRing(const SharedMemoryRing&)            = delete;
+            SharedMemoryRing& operator=(const SharedMemoryRing&) = delete;
+
+            /**
+             * @brief Writes a message into the ring, and wakes any readers that are waiting for one.
+             *
+             * @param size the size of the payload in bytes, which must be no more than max_payload
+             * @param fill a function that writes the payload into the memory it is given. If it throws, the message
+             *             is dropped so readers skip it, and the exception is rethrown.
+             */
+            void write(size_t size, const std::function<void(char*)>& fill);
+
+            /**
+             * @brief Starts reading messages from this ring. Only messages that are written after this are read.
+             *
+             * @param reader the id of the Doorbell to ring when new messages arrive
+             */
+            void subscribe(uint64_t reader);
+
+            /// @brief If subscribe has been called on this ring
+            bool subscribed() const;
+
+            /**
+             * @brief Reads all of the messages that are waiting in the ring.
+             *
+             * @details This returns once there are no messages left and this reader has been marked as waiting, so
+             *          the next message that is written will ring our doorbell.
+             *
+             * @param callback called with each message in order
+             */
+            void read(const std::function<void(const Message&)>& callback);
+
+        private:
+            struct Header;
+            struct Slot;
+
+            /// @brief opens and maps the segment, returns false if the segment was being removed and must be reopened
+            bool attach();
+            /// @brief gets the slot that a message index is written to
+            Slot& slot(uint64_t index);
+            /// @brief gets the payload area of the slot that a message index is written to
+            char* payload(uint64_t index);
+            /// @brief claims the slot for a message index so that only we write to it, false if a newer writer has it
+            bool claim(uint64_t index);
+            /// @brief marks the slot for a message index as written, false if another writer took it from us
+            bool publish(uint64_t index);
+            /// @brief reads the messages that are in the ring without changing our waiting state
+            void drain(const std::function<void(const Message&)>& callback);
+
+            /// The name of the shared memory segment
+            std::string name;
+            /// The file descriptor of the shared memory segment
+            int fd;
+            /// The size of the part of the segment that holds the header and slots
+            size_t header_length;
+            /// The size of the part of the segment that holds the payloads
+            size_t data_length;
+            /// The start of the mapping
+            Header* header;
+            /// Our index in the reader table, or -1 if we are not reading this ring
+            int reader_index;
+            /// The index of the next message we will read
+            uint64_t next;
+        };
+
+    }  // namespace ipc
+}  // namespace extension
+}  // namespace NUClear
+
+#endif  // NUCLEAR_EXTENSION_IPC_SHAREDMEMORYRING_HPP
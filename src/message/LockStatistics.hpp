@@ -0,0 +1,83 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NUCLEAR_MESSAGE_LOCKSTATISTICS_HPP
+#define NUCLEAR_MESSAGE_LOCKSTATISTICS_HPP
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "../clock.hpp"
+
+namespace NUClear {
+namespace message {
+
+    /**
+     * @brief Holds how contended each of NUClear's locks was over an interval.
+     *
+     * @details
+     *  This is only emitted when NUClear is built with NUCLEAR_PROFILE_LOCKS, every
+     *  PowerPlant::Configuration::statistics_period. The locks are ordered from the most contended (the one threads
+     *  spent the longest waiting for) to the least, and only locks that were acquired during the interval are
+     *  included. Sync groups are included as if they were locks, where waiting is the time a task spent queued behind
+     *  the group and holding is the time a task of the group spent running.
+     */
+    struct LockStatistics {
+
+        struct Lock {
+            Lock()
+                : name()
+                , acquisitions(0)
+                , contentions(0)
+                , total_wait(0)
+                , max_wait(0)
+                , total_hold(0)
+                , max_hold(0) {}
+
+            /// @brief The name of this lock, locks with the same name are counted together
+            std::string name;
+            /// @brief The number of times the lock was acquired
+            uint64_t acquisitions;
+            /// @brief The number of those times the lock was already held, so the thread had to wait for it
+            uint64_t contentions;
+            /// @brief The total time spent waiting to acquire the lock
+            std::chrono::nanoseconds total_wait;
+            /// @brief The longest time spent waiting to acquire the lock
+            std::chrono::nanoseconds max_wait;
+            /// @brief The total time the lock was held
+            std::chrono::nanoseconds total_hold;
+            /// @brief The longest time the lock was held
+            std::chrono::nanoseconds max_hold;
+        };
+
+        LockStatistics() : start(), end(), locks() {}
+
+        /// @brief The start of the interval
+        clock::time_point start;
+        /// @brief The end of the interval
+        clock::time_point end;
+        /// @brief The locks that were acquired during the interval, from the most contended to the least
+        std::vector<Lock> locks;
+    };
+
+}  // namespace message
+}  // namespace NUClear
+
+#endif  // NUCLEAR_MESSAGE_LOCKSTATISTICS_HPP
@@ -0,0 +1,47 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NUCLEAR_MESSAGE_PERSISTENCECONFIGURATION_HPP
+#define NUCLEAR_MESSAGE_PERSISTENCECONFIGURATION_HPP
+
+#include <chrono>
+#include <string>
+
+#include "../clock.hpp"
+
+namespace NUClear {
+namespace message {
+
+    struct PersistenceConfiguration {
+
+        PersistenceConfiguration() : path(""), period(std::chrono::seconds(1)) {}
+
+        PersistenceConfiguration(const std::string& path,
+                                 const clock::duration& period = std::chrono::seconds(1))
+            : path(path), period(period) {}
+
+        /// The file that the snapshot is restored from and written to
+        std::string path;
+        /// How often to write the snapshot if any of the persisted data has changed
+        clock::duration period;
+    };
+
+}  // namespace message
+}  // namespace NUClear
+
+#endif  // NUCLEAR_MESSAGE_PERSISTENCECONFIGURATION_HPP
@@ -19,14 +19,61 @@
 #ifndef NUCLEAR_MESSAGE_REACTIONSTATISTICS_HPP
 #define NUCLEAR_MESSAGE_REACTIONSTATISTICS_HPP
 
+#include <chrono>
+#include <cstdint>
+#include <exception>
 #include <string>
 #include <vector>
 
 #include "../clock.hpp"
+#include "../util/AllocationCounters.hpp"
+#include "../util/PerformanceCounters.hpp"
 
 namespace NUClear {
 namespace message {
 
+    /**
+     * @brief The strings that identify a reaction: its label, reactor name, DSL and callback type.
+     *
+     * @details
+     *  These strings are interned when the reaction is created and are never freed, so this only holds a pointer to
+     *  them. This makes copying an identifier into the statistics of every task as cheap as copying a pointer.
+     */
+    struct ReactionIdentifier {
+
+        ReactionIdentifier() : strings(&empty()) {}
+
+        explicit ReactionIdentifier(const std::vector<std::string>& strings) : strings(&strings) {}
+
+        const std::string& operator[](size_t i) const {
+            return (*strings)[i];
+        }
+
+        size_t size() const {
+            return strings->size();
+        }
+
+        std::vector<std::string>::const_iterator begin() const {
+            return strings->begin();
+        }
+
+        std::vector<std::string>::const_iterator end() const {
+            return strings->end();
+        }
+
+        operator const std::vector<std::string>&() const {
+            return *strings;
+        }
+
+    private:
+        static const std::vector<std::string>& empty() {
+            static const std::vector<std::string> e;
+            return e;
+        }
+
+        const std::vector<std::string>* strings;
+    };
+
     /**
      * @brief Holds details about reactions that are executed.
      */
@@ -41,9 +88,14 @@ namespace message {
             , emitted()
             , started()
             , finished()
-            , exception(nullptr) {}
+            , exception(nullptr)
+            , cpu_time(0)
+            , voluntary_context_switches(0)
+            , involuntary_context_switches(0)
+            , performance()
+            , allocations() {}
 
-        ReactionStatistics(const std::vector<std::string> identifier,
+        ReactionStatistics(const ReactionIdentifier& identifier,
                            uint64_t reaction_id,
                            uint64_t task_id,
                            uint64_t cause_reaction_id,
@@ -60,10 +112,15 @@ namespace message {
             , emitted(emitted)
             , started(start)
             , finished(finish)
-            , exception(exception) {}
+            , exception(exception)
+            , cpu_time(0)
+            , voluntary_context_switches(0)
+            , involuntary_context_switches(0)
+            , performance()
+            , allocations() {}
 
         /// @brief A string containing the username/on arguments/and callback name of the reaction.
-        std::vector<std::string> identifier;
+        ReactionIdentifier identifier;
         /// @brief The id of this reaction.
         uint64_t reaction_id;
         /// @brief The task id of this reaction.
@@ -80,6 +137,16 @@ namespace message {
         clock::time_point finished;
         /// @brief An exception pointer that can be rethrown (if the reaction threw an exception)
         std::exception_ptr exception;
+        /// @brief The CPU time this task used, only measured for reactions that use CPUTime
+        std::chrono::nanoseconds cpu_time;
+        /// @brief The times this task gave up the CPU (such as to wait on a lock), only measured with CPUTime
+        int64_t voluntary_context_switches;
+        /// @brief The times this task was preempted, only measured for reactions that use CPUTime
+        int64_t involuntary_context_switches;
+        /// @brief The performance counter events of this task, only measured for reactions that use PerfCounters
+        util::PerformanceCounters performance;
+        /// @brief The memory allocations this task made, only counted when built with NUCLEAR_TRACK_ALLOCATIONS
+        util::AllocationCounters allocations;
     };
 
 }  // namespace message
@@ -0,0 +1,95 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NUCLEAR_MESSAGE_REACTIONSTATISTICSSUMMARY_HPP
+#define NUCLEAR_MESSAGE_REACTIONSTATISTICSSUMMARY_HPP
+
+#include <vector>
+
+#include "../clock.hpp"
+#include "../util/LatencyHistogram.hpp"
+#include "ReactionStatistics.hpp"
+
+namespace NUClear {
+namespace message {
+
+    /**
+     * @brief Holds the aggregated details of the tasks each reaction ran over an interval.
+     *
+     * @details
+     *  This is emitted every PowerPlant::Configuration::statistics_period when that is set. Only reactions that ran
+     *  at least one task during the interval are included. Tail latencies can be read from the histograms, for
+     *  example @code reaction.wait_histogram.percentile(99.9) @endcode
+     */
+    struct ReactionStatisticsSummary {
+
+        struct Reaction {
+            Reaction()
+                : identifier()
+                , reaction_id(0)
+                , count(0)
+                , exceptions(0)
+                , total_runtime(0)
+                , min_runtime(0)
+                , max_runtime(0)
+                , total_wait(0)
+                , allocations(0)
+                , allocated_bytes(0)
+                , runtime_histogram()
+                , wait_histogram() {}
+
+            /// @brief The strings that identify this reaction
+            ReactionIdentifier identifier;
+            /// @brief The id of this reaction
+            uint64_t reaction_id;
+            /// @brief The number of tasks that finished during the interval
+            uint64_t count;
+            /// @brief The number of those tasks that threw an exception
+            uint64_t exceptions;
+            /// @brief The total time those tasks spent running
+            clock::duration total_runtime;
+            /// @brief The shortest time one of those tasks spent running
+            clock::duration min_runtime;
+            /// @brief The longest time one of those tasks spent running
+            clock::duration max_runtime;
+            /// @brief The total time those tasks spent waiting between being emitted and starting to run
+            clock::duration total_wait;
+            /// @brief The number of memory allocations those tasks made, only counted with NUCLEAR_TRACK_ALLOCATIONS
+            uint64_t allocations;
+            /// @brief The total size of the memory allocations those tasks made
+            uint64_t allocated_bytes;
+            /// @brief The distribution of the time those tasks spent running
+            util::LatencyHistogram runtime_histogram;
+            /// @brief The distribution of the time those tasks spent waiting between being emitted and starting to run
+            util::LatencyHistogram wait_histogram;
+        };
+
+        ReactionStatisticsSummary() : start(), end(), reactions() {}
+
+        /// @brief The start of the interval
+        clock::time_point start;
+        /// @brief The end of the interval
+        clock::time_point end;
+        /// @brief The summary of each reaction that ran during the interval
+        std::vector<Reaction> reactions;
+    };
+
+}  // namespace message
+}  // namespace NUClear
+
+#endif  // NUCLEAR_MESSAGE_REACTIONSTATISTICSSUMMARY_HPP
@@ -0,0 +1,53 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NUCLEAR_MESSAGE_TRACECONFIGURATION_HPP
+#define NUCLEAR_MESSAGE_TRACECONFIGURATION_HPP
+
+#include <string>
+
+namespace NUClear {
+namespace message {
+
+    /**
+     * @brief Starts or stops recording a trace of the tasks that run.
+     *
+     * @details
+     *  Emitting this with a path starts recording into a ring of the last events_per_thread tasks for each thread,
+     *  discarding anything recorded before. Emitting this with an empty path stops recording and writes the trace
+     *  to the path it was started with, as does shutting down. The trace is Chrome trace event JSON which can be
+     *  opened with Perfetto or chrome://tracing. Traces are made from ReactionStatistics, so only tasks whose
+     *  statistics are emitted are included.
+     */
+    struct TraceConfiguration {
+
+        TraceConfiguration() : path(""), events_per_thread(65536) {}
+
+        TraceConfiguration(const std::string& path, size_t events_per_thread = 65536)
+            : path(path), events_per_thread(events_per_thread) {}
+
+        /// The file to write the trace to, or empty to stop recording
+        std::string path;
+        /// The number of tasks to keep for each thread, older tasks are overwritten
+        size_t events_per_thread;
+    };
+
+}  // namespace message
+}  // namespace NUClear
+
+#endif  // NUCLEAR_MESSAGE_TRACECONFIGURATION_HPP
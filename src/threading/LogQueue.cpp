@@ -0,0 +1,89 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "LogQueue.hpp"
+
+namespace NUClear {
+namespace threading {
+
+    namespace {
+        std::atomic<uint64_t> log_queue_serial_source(0);  // NOLINT
+    }  // namespace
+
+    LogQueue::LogQueue()
+        : serial(++log_queue_serial_source)
+        , mutex("LogQueue")
+        , consumer_mutex("LogQueue Consumer")
+        , wait_mutex("LogQueue Wait")
+        , sleeping(false)
+        , dropped_messages(0) {}
+
+    LogQueue::Ring& LogQueue::local() {
+
+        // The ring this thread has for each queue, there is normally only one
+        thread_local std::vector<std::pair<uint64_t, std::shared_ptr<Ring>>> cache;
+
+        for (auto& r : cache) {
+            if (r.first == serial) { return *r.second; }
+        }
+
+        auto ring = std::make_shared<Ring>();
+        /* Mutex Scope */ {
+            std::lock_guard<util::Mutex> lock(mutex);
+            rings.push_back(ring);
+        }
+        cache.emplace_back(serial, ring);
+        return *ring;
+    }
+
+    void LogQueue::wait(const std::chrono::steady_clock::duration& timeout) {
+
+        // Say we are about to sleep before checking, so a message pushed after the check will wake us
+        sleeping = true;
+
+        std::vector<std::shared_ptr<Ring>> current;
+        /* Mutex Scope */ {
+            std::lock_guard<util::Mutex> lock(mutex);
+            current = rings;
+        }
+        for (auto& ring : current) {
+            if (ring->head.load(std::memory_order_relaxed) != ring->tail.load(std::memory_order_acquire)) {
+                sleeping = false;
+                return;
+            }
+        }
+
+        util::Mutex::unique_lock lock(wait_mutex);
+        condition.wait_for(lock, timeout, [this] { return !sleeping; });
+        sleeping = false;
+    }
+
+    void LogQueue::wake() {
+        // Only the first message after the consumer went to sleep needs to wake it up
+        if (sleeping.exchange(false)) {
+            std::lock_guard<util::Mutex> lock(wait_mutex);
+            condition.notify_one();
+        }
+    }
+
+    uint64_t LogQueue::dropped() {
+        return dropped_messages.exchange(0, std::memory_order_relaxed);
+    }
+
+}  // namespace threading
+}  // namespace NUClear
@@ -0,0 +1,279 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NUCLEAR_THREADING_LOGQUEUE_HPP
+#define NUCLEAR_THREADING_LOGQUEUE_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <initializer_list>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "../LogLevel.hpp"
+#include "../message/ReactionStatistics.hpp"
+#include "../util/Mutex.hpp"
+#include "../util/Sequence.hpp"
+
+namespace NUClear {
+namespace threading {
+
+    namespace log_capture {
+
+        /// Arguments that are not cheap to keep are formatted straight away
+        template <typename T, typename Enable = void>
+        struct Capture {
+            using type = std::string;
+            static type capture(const T& value) {
+                std::ostringstream output;
+                output << value;
+                return output.str();
+            }
+        };
+
+        /// Numbers are kept as they are and formatted later
+        template <typename T>
+        struct Capture<T, typename std::enable_if<std::is_arithmetic<T>::value || std::is_enum<T>::value>::type> {
+            using type = T;
+            static type capture(const T& value) {
+                return value;
+            }
+        };
+
+        /// Strings are copied, as what a char pointer points to may not outlive the log call
+        template <typename T>
+        struct Capture<T,
+                       typename std::enable_if<std::is_same<T, std::string>::value || std::is_same<T, char*>::value
+                                               || std::is_same<T, const char*>::value>::type> {
+            using type = std::string;
+            static type capture(const T& value) {
+                return type(value);
+            }
+        };
+
+        template <typename T>
+        using captured_t = typename Capture<typename std::decay<T>::type>::type;
+
+    }  // namespace log_capture
+
+    /**
+     * @brief Holds the log messages of a PowerPlant until a background thread formats and emits them.
+     *
+     * @details
+     *  Each thread that logs gets its own ring of entries that only it writes to and only the consumer reads from, so
+     *  logging never takes a lock or waits on the consumer. Numbers and strings are copied into the entry and only
+     *  formatted by the consumer, anything else is formatted when it is logged. When a thread's ring is full its log
+     *  messages are dropped and counted rather than waiting for the consumer to catch up.
+     */
+    class LogQueue {
+    public:
+        /// @brief The number of log messages each thread can have waiting, and the space each has for its arguments
+        enum { CAPACITY = 512, STORAGE = 128 };
+
+        LogQueue();
+
+        /**
+         * @brief Adds a log message to the calling thread's ring.
+         *
+         * @param level the level of the message
+         * @param task  the statistics of the task that logged the message, which are copied as the task will be gone
+         *              by the time the message is emitted
+         * @param args  the arguments that make up the message, which are joined with spaces
+         *
+         * @return true if the message was added, false if the ring was full and it was dropped
+         */
+        template <typename... Arguments>
+        bool push(LogLevel level, const message::ReactionStatistics* task, Arguments&&... args) {
+
+            Ring& ring  = local();
+            size_t tail = ring.tail.load(std::memory_order_relaxed);
+            if (tail - ring.head.load(std::memory_order_acquire) >= CAPACITY) {
+                dropped_messages.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+
+            Entry& entry   = ring.entries[tail % CAPACITY];
+            entry.level    = level;
+            entry.has_task = task != nullptr;
+            if (task != nullptr) { entry.task = *task; }
+            using Stored = Captured<log_capture::captured_t<Arguments>...>;
+            store(entry,
+                  std::integral_constant<bool,
+                                         sizeof(Stored) <= STORAGE
+                                             && alignof(Stored) <= alignof(std::max_align_t)>(),
+                  std::forward<Arguments>(args)...);
+            ring.tail.store(tail + 1, std::memory_order_release);
+
+            wake();
+            return true;
+        }
+
+        /**
+         * @brief Formats every waiting log message in the order each thread logged them.
+         *
+         * @param function called with the level, message and task statistics of each log message
+         */
+        template <typename Function>
+        void consume(Function&& function) {
+
+            std::lock_guard<util::Mutex> lock(consumer_mutex);
+
+            std::vector<std::shared_ptr<Ring>> current;
+            /* Mutex Scope */ {
+                std::lock_guard<util::Mutex> rings_lock(mutex);
+                current = rings;
+            }
+
+            for (auto& ring : current) {
+                size_t head = ring->head.load(std::memory_order_relaxed);
+                size_t tail = ring->tail.load(std::memory_order_acquire);
+                for (; head != tail; ++head) {
+                    Entry& entry = ring->entries[head % CAPACITY];
+
+                    std::ostringstream output;
+                    entry.format(&entry.arguments, output);
+                    function(entry.level, output.str(), entry.has_task ? &entry.task : nullptr);
+
+                    entry.destroy(&entry.arguments);
+                    entry.task.exception = nullptr;
+                    ring->head.store(head + 1, std::memory_order_release);
+                }
+            }
+        }
+
+        /**
+         * @brief Waits until a log message is pushed, wake is called or the timeout passes.
+         *
+         * @param timeout the longest time to wait for
+         */
+        void wait(const std::chrono::steady_clock::duration& timeout);
+
+        /// @brief Wakes the consumer if it is waiting
+        void wake();
+
+        /// @brief Gets the number of log messages dropped since the last call because a ring was full
+        uint64_t dropped();
+
+    private:
+        /// The arguments of a log message, as they are kept in an entry
+        template <typename... Ts>
+        struct Captured {
+            template <typename... Us>
+            explicit Captured(Us&&... values) : values(std::forward<Us>(values)...) {}
+
+            template <int... I>
+            void format(std::ostream& output, util::Sequence<I...> /*indices*/) const {
+                // Join the arguments with spaces, the same as a synchronous log. A braced list runs them in order
+                std::initializer_list<int>{((output << (I == 0 ? "" : " ") << std::get<I>(values)), 0)...};
+            }
+
+            std::tuple<Ts...> values;
+        };
+
+        struct Entry {
+            Entry() : level(), has_task(false), task(), format(nullptr), destroy(nullptr), arguments() {}
+
+            LogLevel level;
+            /// If the message was logged from a task
+            bool has_task;
+            /// The statistics of that task as they were when the message was logged
+            message::ReactionStatistics task;
+            /// Writes the arguments to the output
+            void (*format)(const void* arguments, std::ostream& output);
+            /// Destroys the arguments
+            void (*destroy)(void* arguments);
+            typename std::aligned_storage<STORAGE, alignof(std::max_align_t)>::type arguments;
+        };
+
+        struct Ring {
+            Ring() : head(0), tail(0), entries(new Entry[CAPACITY]) {}
+            ~Ring() {
+                for (size_t i = head; i != tail; ++i) {
+                    entries[i % CAPACITY].destroy(&entries[i % CAPACITY].arguments);
+                }
+            }
+
+            Ring(const Ring&)            = delete;
+            Ring& operator=(const Ring&) = delete;
+
+            /// The next entry to read, only written by the consumer
+            std::atomic<size_t> head;
+            /// The next entry to write, only written by the thread that owns this ring
+            std::atomic<size_t> tail;
+            std::unique_ptr<Entry[]> entries;
+        };
+
+        template <typename Stored>
+        static void emplace(Entry& entry, Stored* /*type*/) {
+            entry.format = [](const void* arguments, std::ostream& output) {
+                const Stored& stored = *static_cast<const Stored*>(arguments);
+                stored.format(output, util::GenerateSequence<0, std::tuple_size<decltype(stored.values)>::value>());
+            };
+            entry.destroy = [](void* arguments) { static_cast<Stored*>(arguments)->~Stored(); };
+        }
+
+        /// Keeps the arguments to format later
+        template <typename... Ts>
+        static void store(Entry& entry, std::true_type /*fits*/, Ts&&... args) {
+            using Stored = Captured<log_capture::captured_t<Ts>...>;
+            new (&entry.arguments) Stored(log_capture::Capture<typename std::decay<Ts>::type>::capture(args)...);
+            emplace(entry, static_cast<Stored*>(nullptr));
+        }
+
+        /// Formats the arguments now, as they are too big to keep in an entry
+        template <typename... Ts>
+        static void store(Entry& entry, std::false_type /*fits*/, Ts&&... args) {
+            using Stored = Captured<std::string>;
+            Captured<Ts&...> arguments(args...);
+            std::ostringstream output;
+            arguments.format(output, util::GenerateSequence<0, sizeof...(Ts)>());
+            new (&entry.arguments) Stored(output.str());
+            emplace(entry, static_cast<Stored*>(nullptr));
+        }
+
+        /// Gets the ring of the calling thread, creating it the first time
+        Ring& local();
+
+        /// Tells apart the rings of different queues in each thread's cache
+        const uint64_t serial;
+        /// Guards the list of rings
+        util::Mutex mutex;
+        /// The ring of every thread that has logged
+        std::vector<std::shared_ptr<Ring>> rings;
+        /// Only one thread consumes at a time
+        util::Mutex consumer_mutex;
+        /// Guards waiting for log messages
+        util::Mutex wait_mutex;
+        /// Woken when a log message is pushed
+        util::Mutex::condition_variable condition;
+        /// If the consumer is waiting, or about to wait, for a log message
+        std::atomic<bool> sleeping;
+        /// The number of log messages dropped since dropped was last called
+        std::atomic<uint64_t> dropped_messages;
+    };
+
+}  // namespace threading
+}  // namespace NUClear
+
+#endif  // NUCLEAR_THREADING_LOGQUEUE_HPP
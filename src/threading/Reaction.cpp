@@ -17,19 +17,39 @@
  */
 #include "Reaction.hpp"
 
+#include <mutex>
+#include <set>
 #include <utility>
 
 namespace NUClear {
 namespace threading {
 
+    namespace {
+        /// Every identifier that a reaction has ever had, so that statistics can point at them rather than copy them
+        std::set<std::vector<std::string>>& identifiers() {
+            static std::set<std::vector<std::string>> interned;
+            return interned;
+        }
+        std::mutex identifier_mutex;
+
+        message::ReactionIdentifier intern(std::vector<std::string>&& identifier) {
+            std::lock_guard<std::mutex> lock(identifier_mutex);
+            return message::ReactionIdentifier(*identifiers().insert(std::move(identifier)).first);
+        }
+    }  // namespace
+
     // Initialize our reaction source
     std::atomic<uint64_t> Reaction::reaction_id_source(0);  // NOLINT
 
     Reaction::Reaction(Reactor& reactor, std::vector<std::string>&& identifier, TaskGenerator&& generator)
         : reactor(reactor)
-        , identifier(identifier)
+        , identifier(intern(std::move(identifier)))
         , id(++reaction_id_source)
         , emit_stats(true)
+        , run_inline(false)
+        , measure_cpu(false)
+        , measure_performance(false)
+        , inline_runtime(0)
         , active_tasks(0)
         , enabled(true)
         , generator(generator) {}
@@ -24,6 +24,8 @@
 #include <memory>
 #include <string>
 
+#include "../clock.hpp"
+#include "../message/ReactionStatistics.hpp"
 #include "ReactionTask.hpp"
 
 namespace NUClear {
@@ -55,7 +57,7 @@ namespace threading {
          * @brief Constructs a new Reaction with the passed callback generator and options
          *
          * @param reactor        the reactor this belongs to
-         * @param identifier     string identifier information about the reaction to help identify it
+         * @param identifier     string identifier information about the reaction to help identify it, this is interned
          * @param callback       the callback generator function (creates databound callbacks)
          */
         Reaction(Reactor& reactor, std::vector<std::string>&& identifier, TaskGenerator&& generator);
@@ -76,7 +78,7 @@ namespace threading {
         Reactor& reactor;
 
         /// @brief This holds the demangled name of the On function that is being called
-        std::vector<std::string> identifier;
+        message::ReactionIdentifier identifier;
 
         /// @brief the unique identifier for this Reaction object
         const uint64_t id;
@@ -84,6 +86,18 @@ namespace threading {
         /// @brief if this is false, we cannot emit ReactionStatistics from any reaction triggered by this one
         bool emit_stats;
 
+        /// @brief if tasks for this reaction can be run by the thread that emitted their data instead of being queued
+        bool run_inline;
+
+        /// @brief if the CPU time and context switches of this reaction's tasks are measured for their statistics
+        bool measure_cpu;
+
+        /// @brief if the performance counters of this reaction's tasks are measured for their statistics
+        bool measure_performance;
+
+        /// @brief a moving average of how long this reaction's tasks take when they are run inline
+        std::atomic<clock::rep> inline_runtime;
+
         /// @brief the number of currently active tasks (existing reaction tasks)
         std::atomic<int> active_tasks;
 
@@ -44,7 +44,7 @@ namespace threading {
                                                 clock::time_point(std::chrono::seconds(0)),
                                                 nullptr})
         , emit_stats(parent.emit_stats && (current_task != nullptr ? current_task->emit_stats : true))
-        , callback(callback) {}
+        , callback(std::move(callback)) {}
 
     const ReactionTask* ReactionTask::get_current_task() {
         return current_task;
@@ -0,0 +1,154 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "StatisticsAggregator.hpp"
+
+#include <algorithm>
+
+namespace NUClear {
+namespace threading {
+
+    namespace {
+        std::atomic<uint64_t> aggregator_serial_source(0);  // NOLINT
+
+        template <typename T, typename Compare>
+        void update_extreme(std::atomic<T>& extreme, const T& value, Compare compare) {
+            T current = extreme.load(std::memory_order_relaxed);
+            while (compare(value, current)
+                   && !extreme.compare_exchange_weak(current, value, std::memory_order_relaxed)) {}
+        }
+
+        void collect(std::atomic<uint32_t>* buckets, util::LatencyHistogram& histogram) {
+            for (size_t i = 0; i < util::LatencyHistogram::BUCKETS; ++i) {
+                // Most buckets are empty so avoid writing to them
+                if (buckets[i].load(std::memory_order_relaxed) != 0) {
+                    histogram.add(i, buckets[i].exchange(0, std::memory_order_relaxed));
+                }
+            }
+        }
+    }  // namespace
+
+    StatisticsAggregator::StatisticsAggregator() : serial(++aggregator_serial_source), start(clock::now()) {}
+
+    StatisticsAggregator::ThreadCounters& StatisticsAggregator::local() {
+
+        // The counters this thread has for each aggregator, there is normally only one
+        thread_local std::vector<std::pair<uint64_t, std::shared_ptr<ThreadCounters>>> cache;
+
+        for (auto& c : cache) {
+            if (c.first == serial) { return *c.second; }
+        }
+
+        auto counters = std::make_shared<ThreadCounters>();
+        /* Mutex Scope */ {
+            std::lock_guard<std::mutex> lock(mutex);
+            threads.push_back(counters);
+        }
+        cache.emplace_back(serial, counters);
+        return *counters;
+    }
+
+    void StatisticsAggregator::record(const message::ReactionStatistics& stats) {
+
+        ThreadCounters& thread = local();
+
+        // Only this thread adds to this map so it can look without locking
+        auto it = thread.reactions.find(stats.reaction_id);
+        if (it == thread.reactions.end()) {
+            std::lock_guard<std::mutex> lock(thread.mutex);
+            it = thread.reactions
+                     .emplace(stats.reaction_id, std::make_unique<Counters>(stats.identifier))
+                     .first;
+        }
+        Counters& counters = *it->second;
+
+        clock::duration runtime_duration = stats.finished - stats.started;
+        clock::duration wait_duration    = stats.started - stats.emitted;
+        clock::rep runtime               = runtime_duration.count();
+        clock::rep wait                  = wait_duration.count();
+
+        counters.count.fetch_add(1, std::memory_order_relaxed);
+        if (stats.exception) { counters.exceptions.fetch_add(1, std::memory_order_relaxed); }
+        counters.total_runtime.fetch_add(runtime, std::memory_order_relaxed);
+        counters.total_wait.fetch_add(wait, std::memory_order_relaxed);
+        counters.allocations.fetch_add(stats.allocations.allocations, std::memory_order_relaxed);
+        counters.allocated_bytes.fetch_add(stats.allocations.bytes, std::memory_order_relaxed);
+        update_extreme(counters.min_runtime, runtime, std::less<clock::rep>());
+        update_extreme(counters.max_runtime, runtime, std::greater<clock::rep>());
+
+        size_t runtime_bucket = util::LatencyHistogram::bucket(runtime_duration);
+        size_t wait_bucket    = util::LatencyHistogram::bucket(wait_duration);
+        counters.runtime_buckets[runtime_bucket].fetch_add(1, std::memory_order_relaxed);
+        counters.wait_buckets[wait_bucket].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    std::unique_ptr<message::ReactionStatisticsSummary> StatisticsAggregator::summarise() {
+
+        auto summary = std::make_unique<message::ReactionStatisticsSummary>();
+        std::map<uint64_t, message::ReactionStatisticsSummary::Reaction> reactions;
+
+        std::lock_guard<std::mutex> lock(mutex);
+
+        summary->start = start;
+        summary->end   = clock::now();
+        start          = summary->end;
+
+        for (auto& thread : threads) {
+            std::lock_guard<std::mutex> thread_lock(thread->mutex);
+
+            for (auto& r : thread->reactions) {
+                Counters& counters = *r.second;
+
+                uint64_t count = counters.count.exchange(0, std::memory_order_relaxed);
+                if (count == 0) { continue; }
+
+                auto& reaction       = reactions[r.first];
+                bool first           = reaction.count == 0;
+                reaction.identifier  = counters.identifier;
+                reaction.reaction_id = r.first;
+                reaction.count += count;
+                reaction.exceptions += counters.exceptions.exchange(0, std::memory_order_relaxed);
+                reaction.total_runtime +=
+                    clock::duration(counters.total_runtime.exchange(0, std::memory_order_relaxed));
+                reaction.total_wait += clock::duration(counters.total_wait.exchange(0, std::memory_order_relaxed));
+                reaction.allocations += counters.allocations.exchange(0, std::memory_order_relaxed);
+                reaction.allocated_bytes += counters.allocated_bytes.exchange(0, std::memory_order_relaxed);
+
+                clock::duration min(counters.min_runtime.exchange(std::numeric_limits<clock::rep>::max(),
+                                                                  std::memory_order_relaxed));
+                clock::duration max(counters.max_runtime.exchange(0, std::memory_order_relaxed));
+                // A task can be counted before its runtime is, so there may not be a minimum yet
+                min                  = std::min(min, max);
+                reaction.min_runtime = first ? min : std::min(reaction.min_runtime, min);
+                reaction.max_runtime = first ? max : std::max(reaction.max_runtime, max);
+
+                collect(counters.runtime_buckets.get(), reaction.runtime_histogram);
+                collect(counters.wait_buckets.get(), reaction.wait_histogram);
+            }
+        }
+
+        summary->reactions.reserve(reactions.size());
+        for (auto& r : reactions) {
+            summary->reactions.push_back(r.second);
+        }
+
+        return summary;
+    }
+
+}  // namespace threading
+}  // namespace NUClear
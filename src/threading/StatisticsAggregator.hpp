@@ -0,0 +1,115 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NUCLEAR_THREADING_STATISTICSAGGREGATOR_HPP
+#define NUCLEAR_THREADING_STATISTICSAGGREGATOR_HPP
+
+#include <atomic>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "../message/ReactionStatistics.hpp"
+#include "../message/ReactionStatisticsSummary.hpp"
+
+namespace NUClear {
+namespace threading {
+
+    /**
+     * @brief Aggregates the statistics of finished tasks for each reaction.
+     *
+     * @details
+     *  Along with totals, the runtime and wait time of each reaction's tasks are counted in LatencyHistogram buckets.
+     *  Each thread that records statistics gets its own set of counters, so recording a task never touches memory
+     *  that another thread is writing to and never takes a lock (except the first time a thread sees a reaction).
+     *  Summarising swaps every counter back to its initial value, so each summary covers the tasks that finished
+     *  since the last one. As counters are swapped one at a time, a task that finishes while a summary is being made
+     *  can have some of its values counted in this summary and the rest in the next.
+     */
+    class StatisticsAggregator {
+    public:
+        StatisticsAggregator();
+
+        /**
+         * @brief Adds the statistics of a finished task to the counters of the calling thread.
+         *
+         * @param stats the statistics of the task
+         */
+        void record(const message::ReactionStatistics& stats);
+
+        /**
+         * @brief Collects the counters of every thread into a summary of the tasks since the last summary.
+         *
+         * @return the summary of each reaction that ran at least one task
+         */
+        std::unique_ptr<message::ReactionStatisticsSummary> summarise();
+
+    private:
+        struct Counters {
+            explicit Counters(const message::ReactionIdentifier& identifier)
+                : identifier(identifier)
+                , count(0)
+                , exceptions(0)
+                , total_runtime(0)
+                , min_runtime(std::numeric_limits<clock::rep>::max())
+                , max_runtime(0)
+                , total_wait(0)
+                , allocations(0)
+                , allocated_bytes(0)
+                , runtime_buckets(new std::atomic<uint32_t>[util::LatencyHistogram::BUCKETS]())
+                , wait_buckets(new std::atomic<uint32_t>[util::LatencyHistogram::BUCKETS]()) {}
+
+            const message::ReactionIdentifier identifier;
+            std::atomic<uint64_t> count;
+            std::atomic<uint64_t> exceptions;
+            std::atomic<clock::rep> total_runtime;
+            std::atomic<clock::rep> min_runtime;
+            std::atomic<clock::rep> max_runtime;
+            std::atomic<clock::rep> total_wait;
+            std::atomic<uint64_t> allocations;
+            std::atomic<uint64_t> allocated_bytes;
+            std::unique_ptr<std::atomic<uint32_t>[]> runtime_buckets;
+            std::unique_ptr<std::atomic<uint32_t>[]> wait_buckets;
+        };
+
+        struct ThreadCounters {
+            /// Held while adding a reaction to this thread, and while summarising
+            std::mutex mutex;
+            /// The counters for each reaction that has run on this thread
+            std::map<uint64_t, std::unique_ptr<Counters>> reactions;
+        };
+
+        /// Gets the counters of the calling thread, creating them the first time
+        ThreadCounters& local();
+
+        /// Tells apart the counters of different aggregators in each thread's cache
+        const uint64_t serial;
+        /// Guards the list of threads and the start of the interval
+        std::mutex mutex;
+        /// The counters of every thread that has recorded statistics
+        std::vector<std::shared_ptr<ThreadCounters>> threads;
+        /// When the current interval started
+        clock::time_point start;
+    };
+
+}  // namespace threading
+}  // namespace NUClear
+
+#endif  // NUCLEAR_THREADING_STATISTICSAGGREGATOR_HPP
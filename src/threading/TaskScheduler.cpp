@@ -18,14 +18,18 @@
 
 #include "TaskScheduler.hpp"
 
+#include "../PowerPlant.hpp"
+#include "../util/FlightRecorder.hpp"
+
 namespace NUClear {
 namespace threading {
 
-    TaskScheduler::TaskScheduler() : running(true) {}
+    TaskScheduler::TaskScheduler(size_t idle_limit)
+        : running(true), mutex("TaskScheduler"), idle_next(0), idle_limit(idle_limit), idle_active(0) {}
 
     void TaskScheduler::shutdown() {
         {
-            std::lock_guard<std::mutex> lock(mutex);
+            std::lock_guard<util::Mutex> lock(mutex);
             running = false;
         }
         condition.notify_all();
@@ -36,8 +40,10 @@ namespace threading {
         // We do not accept new tasks once we are shutdown
         if (running) {
 
+            util::FlightRecorder::record(util::FlightRecorder::Event::SUBMIT, task->parent.id, task->id);
+
             /* Mutex Scope */ {
-                std::lock_guard<std::mutex> lock(mutex);
+                std::lock_guard<util::Mutex> lock(mutex);
                 queue.push(std::forward<std::unique_ptr<ReactionTask>>(task));
             }
         }
@@ -49,7 +55,7 @@ namespace threading {
     std::unique_ptr<ReactionTask> TaskScheduler::get_task() {
 
         // Obtain the lock
-        std::unique_lock<std::mutex> lock(mutex);
+        util::Mutex::unique_lock lock(mutex);
 
         // While our queue is empty
         while (queue.empty()) {
@@ -64,8 +70,16 @@ namespace threading {
                 return nullptr;
             }
 
+            // We have nothing else to do, so see if there is any idle work
+            auto idle = get_idle_task(lock);
+            if (idle) { return idle; }
+
             // Wait for something to happen!
-            condition.wait(lock);
+            if (queue.empty() && running) {
+                util::FlightRecorder::record(util::FlightRecorder::Event::PARK);
+                condition.wait(lock);
+                util::FlightRecorder::record(util::FlightRecorder::Event::WAKE);
+            }
         }
 
         // Return the type
@@ -75,7 +89,78 @@ namespace threading {
             std::move(const_cast<std::unique_ptr<ReactionTask>&>(queue.top())));  // NOLINT
         queue.pop();
 
+        util::FlightRecorder::record(util::FlightRecorder::Event::DEQUEUE, task->parent.id, task->id);
+
         return task;
     }
+
+    std::unique_ptr<ReactionTask> TaskScheduler::get_idle_task(util::Mutex::unique_lock& lock) {
+
+        if (idle_tasks.empty() || idle_active >= idle_limit) { return nullptr; }
+
+        // Take our place as an idle thread and give every idle reaction a turn, starting from the next one
+        ++idle_active;
+        std::vector<std::shared_ptr<Reaction>> reactions(idle_tasks.begin() + (idle_next % idle_tasks.size()),
+                                                         idle_tasks.end());
+        reactions.insert(reactions.end(), idle_tasks.begin(), idle_tasks.begin() + (idle_next % idle_tasks.size()));
+        ++idle_next;
+
+        lock.unlock();
+
+        std::unique_ptr<ReactionTask> task;
+        for (auto& reaction : reactions) {
+            try {
+                task = reaction->get_task();
+            }
+            // If there is an exception while generating a reaction print it here, this shouldn't happen
+            catch (const std::exception& ex) {
+                reaction->reactor.log<NUClear::ERROR>("There was an exception while generating a reaction",
+                                                      ex.what());
+            }
+            catch (...) {
+                reaction->reactor.log<NUClear::ERROR>("There was an unknown exception while generating a reaction");
+            }
+            if (task) { break; }
+        }
+
+        lock.lock();
+
+        if (!task) {
+            --idle_active;
+            return nullptr;
+        }
+
+        // Give up our place once the task has run. If it is rescheduled it will run again later, but we are free now
+        auto callback  = std::move(task->callback);
+        auto released  = std::make_shared<bool>(false);
+        task->callback = [this, callback, released](std::unique_ptr<ReactionTask>&& t) {
+            t = callback(std::move(t));
+            if (!*released) {
+                *released = true;
+                --idle_active;
+            }
+            return std::move(t);
+        };
+
+        return task;
+    }
+
+    void TaskScheduler::add_idle_task(const std::shared_ptr<Reaction>& reaction) {
+        /* Mutex Scope */ {
+            std::lock_guard<util::Mutex> lock(mutex);
+            idle_tasks.push_back(reaction);
+        }
+
+        // Wake up any threads that are waiting so they can run it
+        condition.notify_all();
+    }
+
+    void TaskScheduler::remove_idle_task(uint64_t id) {
+        std::lock_guard<util::Mutex> lock(mutex);
+        idle_tasks.erase(std::remove_if(idle_tasks.begin(),
+                                        idle_tasks.end(),
+                                        [id](const std::shared_ptr<Reaction>& r) { return r->id == id; }),
+                         idle_tasks.end());
+    }
 }  // namespace threading
 }  // namespace NUClear
@@ -29,6 +29,7 @@
 #include <typeindex>
 #include <vector>
 
+#include "../util/Mutex.hpp"
 #include "Reaction.hpp"
 
 namespace NUClear {
@@ -62,13 +63,21 @@ namespace threading {
      *  @code Single @endcode
      *  If single is encountered while processing the function, and a Task object for this Reaction is already running
      *  in a thread, or waiting in the Queue, then this task is ignored and dropped from the system.
+     *
+     *  @em Idle
+     *  @code Idle @endcode
+     *  Idle reactions are not queued. Instead, when a thread asks for a task and the queue is empty, it will run a
+     *  task from one of the idle reactions rather than waiting. Only a limited number of threads will run idle tasks
+     *  at the same time.
      */
     class TaskScheduler {
     public:
         /**
          * @brief Constructs a new TaskScheduler instance, and builds the nullptr sync queue.
+         *
+         * @param idle_limit the maximum number of threads that can be running idle tasks at once
          */
-        TaskScheduler();
+        TaskScheduler(size_t idle_limit = 0);
 
         /**
          * @brief
@@ -101,15 +110,48 @@ namespace threading {
          */
         std::unique_ptr<ReactionTask> get_task();
 
+        /**
+         * @brief Adds a reaction that will be run when a thread has nothing else to do.
+         *
+         * @param reaction the reaction to run when idle
+         */
+        void add_idle_task(const std::shared_ptr<Reaction>& reaction);
+
+        /**
+         * @brief Removes a reaction from the reactions that are run when idle.
+         *
+         * @param id the id of the reaction to remove
+         */
+        void remove_idle_task(uint64_t id);
+
     private:
+        /**
+         * @brief Gets a task from one of the idle reactions, if we are allowed to run one.
+         *
+         * @details The lock is released while the task is generated, as generating a task can submit other tasks.
+         *
+         * @param lock the lock on our mutex, which must be held when this is called
+         *
+         * @return the task to run, or nullptr if there is no idle task to run
+         */
+        std::unique_ptr<ReactionTask> get_idle_task(util::Mutex::unique_lock& lock);
+
         /// @brief if the scheduler is running or is shut down
         volatile bool running;
         /// @brief our queue which sorts tasks by priority
         std::priority_queue<std::unique_ptr<ReactionTask>> queue;
         /// @brief the mutex which our threads synchronize their access to this object
-        std::mutex mutex;
+        util::Mutex mutex;
         /// @brief the condition object that threads wait on if they can't get a task
-        std::condition_variable condition;
+        util::Mutex::condition_variable condition;
+        /// @brief the reactions to run when there is nothing else to do
+        std::vector<std::shared_ptr<Reaction>> idle_tasks;
+        /// @brief the index of the idle reaction to try first, so they all get a turn
+        size_t idle_next;
+        /// @brief the maximum number of threads that can be running idle tasks at once
+        const size_t idle_limit;
+        /// @brief the number of threads that are currently running idle tasks
+        std::atomic<size_t> idle_active;
     };
 
 }  // namespace threading
@@ -0,0 +1,173 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "AllocationCounters.hpp"
+
+#include <cstdlib>
+
+#include "platform.hpp"
+
+#ifdef NUCLEAR_TRACK_ALLOCATIONS
+#    ifndef __GLIBC__
+#        include <new>
+#    endif
+#endif
+
+namespace NUClear {
+namespace util {
+
+    namespace {
+
+        /// The counters of one thread, this is plain data so that using it can never allocate
+        struct ThreadAllocations {
+            uint64_t allocations;
+            uint64_t bytes;
+            uint64_t deallocations;
+        };
+
+        ATTRIBUTE_TLS ThreadAllocations thread_allocations = {0, 0, 0};  // NOLINT
+
+#ifdef NUCLEAR_TRACK_ALLOCATIONS
+        inline void count_allocation(std::size_t size) {
+            ++thread_allocations.allocations;
+            thread_allocations.bytes += size;
+        }
+
+        inline void count_deallocation(void* ptr) {
+            if (ptr != nullptr) { ++thread_allocations.deallocations; }
+        }
+#endif
+
+    }  // namespace
+
+    AllocationCounters AllocationCounters::read() {
+        AllocationCounters result;
+        result.allocations   = thread_allocations.allocations;
+        result.bytes         = thread_allocations.bytes;
+        result.deallocations = thread_allocations.deallocations;
+        return result;
+    }
+
+#ifdef NUCLEAR_TRACK_ALLOCATIONS
+    bool AllocationCounters::enabled() {
+        return true;
+    }
+#else
+    bool AllocationCounters::enabled() {
+        return false;
+    }
+#endif
+
+}  // namespace util
+}  // namespace NUClear
+
+#ifdef NUCLEAR_TRACK_ALLOCATIONS
+
+#    ifdef __GLIBC__
+
+// glibc lets us replace malloc and forward to its own implementation, which also counts everything operator new does
+extern "C" {
+void* __libc_malloc(std::size_t size);                    // NOLINT
+void* __libc_calloc(std::size_t count, std::size_t size);  // NOLINT
+void* __libc_realloc(void* ptr, std::size_t size);         // NOLINT
+void __libc_free(void* ptr);                              // NOLINT
+
+void* malloc(std::size_t size) noexcept {
+    NUClear::util::count_allocation(size);
+    return __libc_malloc(size);
+}
+
+void* calloc(std::size_t count, std::size_t size) noexcept {
+    NUClear::util::count_allocation(count * size);
+    return __libc_calloc(count, size);
+}
+
+void* realloc(void* ptr, std::size_t size) noexcept {
+    NUClear::util::count_allocation(size);
+    NUClear::util::count_deallocation(ptr);
+    return __libc_realloc(ptr, size);
+}
+
+void free(void* ptr) noexcept {
+    NUClear::util::count_deallocation(ptr);
+    __libc_free(ptr);
+}
+}
+
+#    else
+
+// Elsewhere we can only replace the global operator new and delete
+void* operator new(std::size_t size) {
+    NUClear::util::count_allocation(size);
+
+    // Like the standard operator new, keep asking the new handler for memory until we get some
+    for (;;) {
+        void* ptr = std::malloc(size == 0 ? 1 : size);
+        if (ptr != nullptr) { return ptr; }
+
+        std::new_handler handler = std::get_new_handler();
+        if (handler == nullptr) { throw std::bad_alloc(); }
+        handler();
+    }
+}
+
+void* operator new[](std::size_t size) {
+    return ::operator new(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t& /*tag*/) noexcept {
+    try {
+        return ::operator new(size);
+    }
+    catch (...) {
+        return nullptr;
+    }
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t& /*tag*/) noexcept {
+    return ::operator new(size, std::nothrow);
+}
+
+void operator delete(void* ptr) noexcept {
+    NUClear::util::count_deallocation(ptr);
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept {
+    ::operator delete(ptr);
+}
+
+void operator delete(void* ptr, std::size_t /*size*/) noexcept {
+    ::operator delete(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t /*size*/) noexcept {
+    ::operator delete(ptr);
+}
+
+void operator delete(void* ptr, const std::nothrow_t& /*tag*/) noexcept {
+    ::operator delete(ptr);
+}
+
+void operator delete[](void* ptr, const std::nothrow_t& /*tag*/) noexcept {
+    ::operator delete(ptr);
+}
+
+#    endif  // __GLIBC__
+
+#endif  // NUCLEAR_TRACK_ALLOCATIONS
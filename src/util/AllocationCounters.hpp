@@ -0,0 +1,71 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NUCLEAR_UTIL_ALLOCATIONCOUNTERS_HPP
+#define NUCLEAR_UTIL_ALLOCATIONCOUNTERS_HPP
+
+#include <cstdint>
+
+namespace NUClear {
+namespace util {
+
+    /**
+     * @brief Counts of the memory allocations made by a thread.
+     *
+     * @details
+     *  These are only counted when NUClear is built with NUCLEAR_TRACK_ALLOCATIONS, which replaces malloc, calloc,
+     *  realloc and free when using glibc, or the global operator new and delete everywhere else. Without it everything
+     *  reads as zero.
+     */
+    struct AllocationCounters {
+        AllocationCounters() : allocations(0), bytes(0), deallocations(0) {}
+
+        /// @brief The number of blocks of memory that were allocated
+        uint64_t allocations;
+        /// @brief The total size of the blocks of memory that were allocated
+        uint64_t bytes;
+        /// @brief The number of blocks of memory that were freed
+        uint64_t deallocations;
+
+        AllocationCounters operator-(const AllocationCounters& other) const {
+            AllocationCounters c;
+            c.allocations   = allocations - other.allocations;
+            c.bytes         = bytes - other.bytes;
+            c.deallocations = deallocations - other.deallocations;
+            return c;
+        }
+
+        /**
+         * @brief Reads the counters of the calling thread.
+         *
+         * @return the allocations the calling thread has made since it started
+         */
+        static AllocationCounters read();
+
+        /**
+         * @brief If allocations are being counted.
+         *
+         * @return true if NUClear was built with NUCLEAR_TRACK_ALLOCATIONS
+         */
+        static bool enabled();
+    };
+
+}  // namespace util
+}  // namespace NUClear
+
+#endif  // NUCLEAR_UTIL_ALLOCATIONCOUNTERS_HPP
@@ -21,9 +21,13 @@
 
 #include "../dsl/trait/is_transient.hpp"
 #include "../dsl/word/emit/Direct.hpp"
+#include "../util/AllocationCounters.hpp"
+#include "../util/FlightRecorder.hpp"
 #include "../util/MergeTransient.hpp"
+#include "../util/PerformanceCounters.hpp"
 #include "../util/TransientDataElements.hpp"
 #include "../util/apply.hpp"
+#include "../util/current_thread_usage.hpp"
 #include "../util/demangle.hpp"
 #include "../util/update_current_thread_priority.hpp"
 
@@ -80,8 +84,9 @@ namespace util {
                                  typename TransientDataElements<DSL>::index(),
                                  GenerateSequence<0, TransientDataElements<DSL>::index::length>());
 
-                // Check if our data is good (all the data exists) otherwise terminate the call
-                if (!check_data(data)) {
+                // Check if our data is good (all the data exists and passes any filters) otherwise terminate the call
+                // Commits come last as they claim state for the task that is about to be made
+                if (!check_data(data) || !DSL::filter(r, data) || !DSL::commit(r)) {
                     // Take one from our active tasks
                     --r.active_tasks;
 
@@ -90,8 +95,10 @@ namespace util {
                 }
 
                 // We have to make a copy of the callback because the "this" variable can go out of scope
-                auto c = callback;
-                return std::make_pair(DSL::priority(r), [c, data](std::unique_ptr<threading::ReactionTask>&& task) {
+                // The data is moved in so each task takes exactly one reference to each message rather than copying
+                // it again, as every copy is an atomic operation on a reference count that all subscribers share
+                return std::make_pair(DSL::priority(r), [c = callback, data = std::move(data)](
+                                                            std::unique_ptr<threading::ReactionTask>&& task) mutable {
                     // Check if we are going to reschedule
                     task = DSL::reschedule(std::move(task));
 
@@ -102,7 +109,14 @@ namespace util {
                         update_current_thread_priority(task->priority);
 
                         // Record our start time
-                        task->stats->started = clock::now();
+                        const bool measure_cpu         = task->parent.measure_cpu;
+                        const bool measure_performance = task->parent.measure_performance;
+                        ThreadUsage usage              = measure_cpu ? current_thread_usage() : ThreadUsage();
+                        PerformanceCounters counters =
+                            measure_performance ? PerformanceCounters::read() : PerformanceCounters();
+                        AllocationCounters allocations = AllocationCounters::read();
+                        task->stats->started           = clock::now();
+                        FlightRecorder::record(FlightRecorder::Event::START, task->parent.id, task->id);
 
                         // We have to catch any exceptions
                         try {
@@ -116,7 +130,18 @@ namespace util {
                         }
 
                         // Our finish time
-                        task->stats->finished = clock::now();
+                        task->stats->finished    = clock::now();
+                        task->stats->allocations = AllocationCounters::read() - allocations;
+                        if (measure_performance) { task->stats->performance = PerformanceCounters::read() - counters; }
+                        FlightRecorder::record(FlightRecorder::Event::FINISH, task->parent.id, task->id);
+                        if (measure_cpu) {
+                            ThreadUsage end       = current_thread_usage();
+                            task->stats->cpu_time = end.cpu_time - usage.cpu_time;
+                            task->stats->voluntary_context_switches =
+                                end.voluntary_context_switches - usage.voluntary_context_switches;
+                            task->stats->involuntary_context_switches =
+                                end.involuntary_context_switches - usage.involuntary_context_switches;
+                        }
 
                         // Run our postconditions
                         DSL::postcondition(*task);
@@ -126,7 +151,7 @@ namespace util {
 
                         // Emit our reaction statistics if it wouldn't cause a loop
                         if (task->emit_stats) {
-                            PowerPlant::powerplant->emit<dsl::word::emit::Direct>(task->stats);
+                            PowerPlant::emit_statistics(*task);
                         }
                     }
 
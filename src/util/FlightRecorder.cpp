@@ -0,0 +1,233 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "FlightRecorder.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#ifndef _WIN32
+#    include <fcntl.h>
+#    include <unistd.h>
+
+#    include <csignal>
+#endif
+
+namespace NUClear {
+namespace util {
+
+    namespace {
+        /// The most rings that can be dumped, threads beyond this still record but are left out of dumps
+        constexpr size_t max_rings = 256;
+
+        /// Every ring that has been made, rings are never freed so a signal handler can always read them
+        std::array<std::atomic<FlightRecorder::Ring*>, max_rings> rings = {};
+        std::atomic<uint64_t> thread_number_source(0);  // NOLINT
+
+        /// The file that signal dumps are written to
+        int signal_fd = -1;
+
+        /// A time stamp counter reading and the time it was taken, to convert time stamps to times
+        struct Calibration {
+            uint64_t timestamp;
+            std::chrono::steady_clock::time_point time;
+        };
+        const Calibration start_calibration{FlightRecorder::timestamp(), std::chrono::steady_clock::now()};
+
+        /// Copies out the events of a ring that were not overwritten while they were being copied
+        std::vector<FlightRecorder::Record> read(const FlightRecorder::Ring& ring) {
+            // The oldest slot of a full ring is the next one to be written, so it is never read
+            uint64_t end   = ring.head.load(std::memory_order_acquire);
+            uint64_t begin = end > FlightRecorder::CAPACITY - 1 ? end - (FlightRecorder::CAPACITY - 1) : 0;
+
+            std::vector<FlightRecorder::Record> records;
+            records.reserve(end - begin);
+            for (uint64_t i = begin; i < end; ++i) {
+                records.push_back(ring.records[i & (FlightRecorder::CAPACITY - 1)]);
+            }
+
+            // Anything the writer has since lapped may be torn, so drop it. The writer stores a record before it moves
+            // head past it, so the record at head may be half written and counts as lapped too.
+            std::atomic_thread_fence(std::memory_order_acquire);
+            uint64_t after = ring.head.load(std::memory_order_relaxed);
+            if (after + 1 > begin + FlightRecorder::CAPACITY) {
+                size_t lost = size_t(std::min(after + 1 - (begin + FlightRecorder::CAPACITY), end - begin));
+                records.erase(records.begin(), records.begin() + lost);
+            }
+            return records;
+        }
+
+#ifndef _WIN32
+        /// Writes an unsigned number, using only functions that are safe in a signal handler
+        void write_number(int fd, uint64_t value) {
+            char buffer[20];
+            size_t n = 0;
+            do {
+                buffer[sizeof(buffer) - ++n] = char('0' + value % 10);
+                value /= 10;
+            } while (value != 0);
+            ssize_t written = ::write(fd, buffer + sizeof(buffer) - n, n);
+            (void) written;
+        }
+
+        void write_string(int fd, const char* str) {
+            size_t n = 0;
+            while (str[n] != '\0') {
+                ++n;
+            }
+            ssize_t written = ::write(fd, str, n);
+            (void) written;
+        }
+
+        void signal_dump(int /*signal*/) {
+            if (signal_fd < 0) { return; }
+
+            ::lseek(signal_fd, 0, SEEK_SET);
+            int result = ::ftruncate(signal_fd, 0);
+            (void) result;
+
+            for (auto& slot : rings) {
+                FlightRecorder::Ring* ring = slot.load(std::memory_order_acquire);
+                if (ring == nullptr) { continue; }
+
+                uint64_t end    = ring->head.load(std::memory_order_acquire);
+                uint64_t begin  = end > FlightRecorder::CAPACITY - 1 ? end - (FlightRecorder::CAPACITY - 1) : 0;
+                uint64_t thread = ring->thread_number.load(std::memory_order_relaxed);
+
+                for (uint64_t i = begin; i < end; ++i) {
+                    const FlightRecorder::Record& r = ring->records[i & (FlightRecorder::CAPACITY - 1)];
+                    write_string(signal_fd, "thread ");
+                    write_number(signal_fd, thread);
+                    write_string(signal_fd, " tsc ");
+                    write_number(signal_fd, r.timestamp);
+                    write_string(signal_fd, " ");
+                    write_string(signal_fd, FlightRecorder::name(r.event));
+                    write_string(signal_fd, " reaction ");
+                    write_number(signal_fd, r.reaction_id);
+                    write_string(signal_fd, " task ");
+                    write_number(signal_fd, r.task_id);
+                    write_string(signal_fd, "\n");
+                }
+            }
+        }
+#endif
+    }  // namespace
+
+    const char* FlightRecorder::name(Event event) {
+        switch (event) {
+            case Event::SUBMIT: return "SUBMIT";
+            case Event::DEQUEUE: return "DEQUEUE";
+            case Event::START: return "START";
+            case Event::FINISH: return "FINISH";
+            case Event::SYNC_BLOCK: return "SYNC_BLOCK";
+            case Event::SYNC_RELEASE: return "SYNC_RELEASE";
+            case Event::PARK: return "PARK";
+            case Event::WAKE: return "WAKE";
+            default: return "UNKNOWN";
+        }
+    }
+
+    FlightRecorder::Ring* FlightRecorder::acquire() {
+
+        // Reuse the ring of a thread that has exited if we can
+        for (auto& slot : rings) {
+            Ring* ring    = slot.load(std::memory_order_acquire);
+            bool expected = false;
+            if (ring != nullptr && ring->in_use.compare_exchange_strong(expected, true)) {
+                // Forget the events of the thread that exited so they are not dumped under this thread's number
+                ring->head.store(0, std::memory_order_release);
+                ring->thread_number.store(++thread_number_source);
+                return ring;
+            }
+        }
+
+        auto ring = std::make_unique<Ring>();
+        ring->in_use.store(true);
+        ring->thread_number.store(++thread_number_source);
+
+        // Take an empty slot so the ring can be dumped
+        for (auto& slot : rings) {
+            Ring* expected = nullptr;
+            if (slot.compare_exchange_strong(expected, ring.get())) { return ring.release(); }
+        }
+
+        // Every slot is taken, so this thread records where nobody will see it
+        return ring.release();
+    }
+
+    void FlightRecorder::release(Ring* ring) {
+        for (auto& slot : rings) {
+            if (slot.load(std::memory_order_acquire) == ring) {
+                ring->in_use.store(false, std::memory_order_release);
+                return;
+            }
+        }
+
+        // This ring was never shared
+        delete ring;
+    }
+
+    void FlightRecorder::dump(std::ostream& out) {
+
+        Calibration now{timestamp(), std::chrono::steady_clock::now()};
+        double ns_per_tick =
+            now.timestamp == start_calibration.timestamp
+                ? 1.0
+                : std::chrono::duration<double, std::nano>(now.time - start_calibration.time).count()
+                      / double(now.timestamp - start_calibration.timestamp);
+
+        std::vector<std::pair<uint64_t, Record>> events;
+        for (auto& slot : rings) {
+            Ring* ring = slot.load(std::memory_order_acquire);
+            if (ring == nullptr) { continue; }
+
+            uint64_t thread = ring->thread_number.load(std::memory_order_relaxed);
+            for (auto& r : read(*ring)) {
+                events.emplace_back(thread, r);
+            }
+        }
+
+        std::stable_sort(events.begin(), events.end(), [](const auto& a, const auto& b) {
+            return a.second.timestamp < b.second.timestamp;
+        });
+
+        for (auto& e : events) {
+            const Record& r = e.second;
+            int64_t ago     = int64_t(double(int64_t(now.timestamp - r.timestamp)) * ns_per_tick);
+            out << "thread " << e.first << " -" << ago << "ns " << name(r.event) << " reaction " << r.reaction_id
+                << " task " << r.task_id << "\n";
+        }
+        out.flush();
+    }
+
+    void FlightRecorder::dump_on_signal(int signal, const std::string& path) {
+#ifndef _WIN32
+        if (signal_fd >= 0) { ::close(signal_fd); }
+        signal_fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        std::signal(signal, signal_dump);
+#else
+        (void) signal;
+        (void) path;
+        throw std::runtime_error("Dumping the flight recorder on a signal is not supported on Windows");
+#endif
+    }
+
+}  // namespace util
+}  // namespace NUClear
@@ -0,0 +1,178 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NUCLEAR_UTIL_FLIGHTRECORDER_HPP
+#define NUCLEAR_UTIL_FLIGHTRECORDER_HPP
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+#include <string>
+
+#if defined(__x86_64__) || defined(__i386__)
+#    include <x86intrin.h>
+#elif defined(_M_X64) || defined(_M_IX86)
+#    include <intrin.h>
+#endif
+
+namespace NUClear {
+namespace util {
+
+    /**
+     * @brief An always on record of the most recent scheduler events on every thread.
+     *
+     * @details
+     *  Each thread writes events into its own ring of the last CAPACITY events, so recording is wait free and costs a
+     *  timestamp read and a few stores. Timestamps come from the CPU's time stamp counter where there is one.
+     *
+     *  When something goes wrong, such as a latency spike, the rings show what the scheduler was doing just before.
+     *  They can be written out at any time with dump, for example from a Watchdog reaction:
+     *  @code
+     *  on<Watchdog<Loop, 10, std::chrono::milliseconds>>().then([] { FlightRecorder::dump(std::cerr); });
+     *  @endcode
+     *  or when the process receives a signal by calling dump_on_signal.
+     */
+    class FlightRecorder {
+    public:
+        enum class Event : uint8_t {
+            /// A task was added to a scheduler's queue
+            SUBMIT,
+            /// A task was taken from a scheduler's queue by a thread
+            DEQUEUE,
+            /// A task's callback started running
+            START,
+            /// A task's callback finished running
+            FINISH,
+            /// A task had to wait because another task in its Sync group was running
+            SYNC_BLOCK,
+            /// A task finished and let the next task in its Sync group run
+            SYNC_RELEASE,
+            /// A thread went to sleep because there was nothing to do
+            PARK,
+            /// A thread woke up
+            WAKE
+        };
+
+        struct Record {
+            /// The time stamp counter when the event happened
+            uint64_t timestamp;
+            /// The task the event is about, or 0 if it is not about a task
+            uint64_t task_id;
+            /// The reaction of that task
+            uint32_t reaction_id;
+            /// What happened
+            Event event;
+        };
+
+        enum : size_t {
+            /// The number of events kept for each thread, this must be a power of two. Dumps show all but the oldest.
+            CAPACITY = 4096
+        };
+
+        struct Ring {
+            Ring() : head(0), in_use(false), thread_number(0), records() {}
+
+            /// The number of events that have ever been written into this ring
+            std::atomic<uint64_t> head;
+            /// If a thread is currently writing to this ring
+            std::atomic<bool> in_use;
+            /// Tells the threads that have used this ring apart in dumps
+            std::atomic<uint64_t> thread_number;
+            /// The events, the latest is at (head - 1) % CAPACITY
+            std::array<Record, CAPACITY> records;
+        };
+
+        /**
+         * @brief Records an event on the calling thread.
+         *
+         * @param event       what happened
+         * @param reaction_id the reaction of the task the event is about
+         * @param task_id     the task the event is about
+         */
+        static inline void record(Event event, uint64_t reaction_id = 0, uint64_t task_id = 0) {
+            Ring& r    = ring();
+            uint64_t h = r.head.load(std::memory_order_relaxed);
+
+            r.records[h & (CAPACITY - 1)] = Record{timestamp(), task_id, uint32_t(reaction_id), event};
+            r.head.store(h + 1, std::memory_order_release);
+        }
+
+        /// @brief Reads the clock that events are timestamped with
+        static inline uint64_t timestamp() {
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+            return __rdtsc();
+#else
+            return uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                std::chrono::steady_clock::now().time_since_epoch())
+                                .count());
+#endif
+        }
+
+        /// @brief The name of an event, as used in dumps
+        static const char* name(Event event);
+
+        /**
+         * @brief Writes the events of every thread as text, one per line and oldest first.
+         *
+         * @details
+         *  Each line has the thread, how many nanoseconds before the dump the event happened, the event, the reaction
+         *  id and the task id. Events that are overwritten while they are being read are left out.
+         *
+         * @param out the stream to write the events to
+         */
+        static void dump(std::ostream& out);
+
+        /**
+         * @brief Writes the events of every thread to a file whenever the process receives a signal.
+         *
+         * @details
+         *  As this runs inside a signal handler, each thread's events are written separately and timestamps are raw
+         *  time stamp counter values rather than times. This is not available on Windows.
+         *
+         * @param signal the signal to dump on, for example SIGUSR1
+         * @param path   the file to write to, which is opened now and overwritten by each dump
+         */
+        static void dump_on_signal(int signal, const std::string& path);
+
+    private:
+        /// Holds the calling thread's ring for as long as the thread exists
+        struct Holder {
+            Holder() : ring(acquire()) {}
+            ~Holder() {
+                release(ring);
+            }
+            Ring* ring;
+        };
+
+        static inline Ring& ring() {
+            thread_local Holder holder;
+            return *holder.ring;
+        }
+
+        /// Gets a ring that no other thread is using
+        static Ring* acquire();
+        /// Gives a ring back when its thread exits, its events are kept until another thread takes and clears it
+        static void release(Ring* ring);
+    };
+
+}  // namespace util
+}  // namespace NUClear
+
+#endif  // NUCLEAR_UTIL_FLIGHTRECORDER_HPP
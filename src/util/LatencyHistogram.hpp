@@ -0,0 +1,176 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NUCLEAR_UTIL_LATENCYHISTOGRAM_HPP
+#define NUCLEAR_UTIL_LATENCYHISTOGRAM_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "../clock.hpp"
+
+namespace NUClear {
+namespace util {
+
+    /**
+     * @brief A log-linear (HDR style) histogram of durations.
+     *
+     * @details
+     *  Durations are counted in nanoseconds. Every power of two range is split into 2^SUB_BUCKET_BITS linear buckets,
+     *  so any duration is reported within about 3% of its true value while the whole range up to 2^MAX_BITS
+     *  nanoseconds (about 18 minutes) needs only a thousand or so buckets. Longer durations are counted in the last
+     *  bucket. Histograms can be merged by adding their buckets together.
+     */
+    class LatencyHistogram {
+    public:
+        enum : size_t {
+            /// The number of bits of precision for each power of two range
+            SUB_BUCKET_BITS = 5,
+            /// Durations of 2^MAX_BITS nanoseconds or longer go in the last bucket
+            MAX_BITS = 40,
+            /// The total number of buckets
+            BUCKETS = (MAX_BITS - SUB_BUCKET_BITS + 1) << SUB_BUCKET_BITS
+        };
+
+        LatencyHistogram() : counts(), total(0) {}
+
+        /**
+         * @brief Finds the bucket that a duration is counted in.
+         *
+         * @param duration the duration to find the bucket for
+         *
+         * @return the index of the bucket, less than BUCKETS
+         */
+        static size_t bucket(const clock::duration& duration) {
+            int64_t ns = std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
+            uint64_t v = ns < 0 ? 0 : std::min(uint64_t(ns), (uint64_t(1) << MAX_BITS) - 1);
+
+            // The first two ranges are linear with one bucket per nanosecond
+            if (v < (uint64_t(1) << (SUB_BUCKET_BITS + 1))) { return size_t(v); }
+
+            size_t shift = msb(v) - SUB_BUCKET_BITS;
+            return (shift << SUB_BUCKET_BITS) + size_t(v >> shift);
+        }
+
+        /// @brief The shortest duration that is counted in a bucket
+        static clock::duration lowest(size_t bucket) {
+            return to_duration(lowest_ns(bucket));
+        }
+
+        /// @brief The longest duration that is counted in a bucket
+        static clock::duration highest(size_t bucket) {
+            return to_duration(lowest_ns(bucket + 1) - 1);
+        }
+
+        /**
+         * @brief Counts a duration.
+         *
+         * @param duration the duration to count
+         * @param n        the number of times to count it
+         */
+        void record(const clock::duration& duration, uint64_t n = 1) {
+            add(bucket(duration), n);
+        }
+
+        /**
+         * @brief Adds to the count of a bucket.
+         *
+         * @param bucket the index of the bucket as given by bucket()
+         * @param n      the number to add
+         */
+        void add(size_t bucket, uint64_t n) {
+            if (n == 0) { return; }
+            if (counts.size() <= bucket) { counts.resize(bucket + 1, 0); }
+            counts[bucket] += n;
+            total += n;
+        }
+
+        /// @brief Adds all of the counts of another histogram to this one
+        void merge(const LatencyHistogram& other) {
+            for (size_t i = 0; i < other.counts.size(); ++i) {
+                add(i, other.counts[i]);
+            }
+        }
+
+        /// @brief The number of durations that have been counted
+        uint64_t count() const {
+            return total;
+        }
+
+        /**
+         * @brief Finds the duration that a percentage of the counted durations are no longer than.
+         *
+         * @param percentile the percentage of durations, from 0 to 100
+         *
+         * @return the longest duration in the bucket that holds the percentile, or zero if nothing was counted
+         */
+        clock::duration percentile(double percentile) const {
+            if (total == 0) { return clock::duration(0); }
+
+            uint64_t target = uint64_t(std::ceil(std::max(0.0, std::min(percentile, 100.0)) / 100.0 * total));
+            target          = std::max(target, uint64_t(1));
+
+            uint64_t seen = 0;
+            for (size_t i = 0; i < counts.size(); ++i) {
+                seen += counts[i];
+                if (seen >= target) { return highest(i); }
+            }
+            return highest(counts.size() - 1);
+        }
+
+        /// @brief The longest duration in the bucket of the longest counted duration
+        clock::duration max() const {
+            return total == 0 ? clock::duration(0) : highest(counts.size() - 1);
+        }
+
+    private:
+        static size_t msb(uint64_t v) {
+#if defined(__GNUC__) || defined(__clang__)
+            return size_t(63 - __builtin_clzll(v));
+#else
+            size_t b = 0;
+            while (v >>= 1) {
+                ++b;
+            }
+            return b;
+#endif
+        }
+
+        static uint64_t lowest_ns(size_t bucket) {
+            if (bucket < (size_t(1) << (SUB_BUCKET_BITS + 1))) { return bucket; }
+
+            size_t shift = (bucket >> SUB_BUCKET_BITS) - 1;
+            return uint64_t(bucket - (shift << SUB_BUCKET_BITS)) << shift;
+        }
+
+        static clock::duration to_duration(uint64_t ns) {
+            return std::chrono::duration_cast<clock::duration>(std::chrono::nanoseconds(ns));
+        }
+
+        /// The count in each bucket, only as long as the last bucket that has been counted in
+        std::vector<uint64_t> counts;
+        /// The sum of all of the counts
+        uint64_t total;
+    };
+
+}  // namespace util
+}  // namespace NUClear
+
+#endif  // NUCLEAR_UTIL_LATENCYHISTOGRAM_HPP
@@ -0,0 +1,118 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "LockProfiler.hpp"
+
+#include <algorithm>
+#include <list>
+#include <mutex>
+
+namespace NUClear {
+namespace util {
+
+    namespace {
+
+        template <typename T>
+        void update_max(std::atomic<T>& max, const T& value) {
+            T current = max.load(std::memory_order_relaxed);
+            while (value > current && !max.compare_exchange_weak(current, value, std::memory_order_relaxed)) {}
+        }
+
+        /// Every lock that has been counted, and when the current interval started
+        struct Registry {
+            Registry() : start(clock::now()) {}
+
+            /// This is a plain mutex so it is never counted itself
+            std::mutex mutex;
+            /// A list so that adding a lock never moves the others
+            std::list<LockProfiler::Lock> locks;
+            clock::time_point start;
+        };
+
+        Registry& registry() {
+            // Never destroyed as locks can be used while other static objects are being destroyed
+            static Registry* r = new Registry();
+            return *r;
+        }
+
+    }  // namespace
+
+    void LockProfiler::Lock::acquired(const std::chrono::nanoseconds& wait) {
+        acquisitions.fetch_add(1, std::memory_order_relaxed);
+        if (wait > std::chrono::nanoseconds(0)) {
+            contentions.fetch_add(1, std::memory_order_relaxed);
+            total_wait.fetch_add(wait.count(), std::memory_order_relaxed);
+            update_max<int64_t>(max_wait, wait.count());
+        }
+    }
+
+    void LockProfiler::Lock::released(const std::chrono::nanoseconds& hold) {
+        total_hold.fetch_add(hold.count(), std::memory_order_relaxed);
+        update_max<int64_t>(max_hold, hold.count());
+    }
+
+    LockProfiler::Lock& LockProfiler::find(const std::string& name) {
+        Registry& r = registry();
+        std::lock_guard<std::mutex> lock(r.mutex);
+
+        for (auto& l : r.locks) {
+            if (l.name == name) { return l; }
+        }
+
+        r.locks.emplace_back(name);
+        return r.locks.back();
+    }
+
+    std::unique_ptr<message::LockStatistics> LockProfiler::summarise() {
+
+        auto summary = std::make_unique<message::LockStatistics>();
+
+        Registry& r = registry();
+        std::lock_guard<std::mutex> lock(r.mutex);
+
+        summary->start = r.start;
+        summary->end   = clock::now();
+        r.start        = summary->end;
+
+        for (auto& l : r.locks) {
+            uint64_t acquisitions = l.acquisitions.exchange(0, std::memory_order_relaxed);
+            if (acquisitions == 0) { continue; }
+
+            message::LockStatistics::Lock stats;
+            stats.name         = l.name;
+            stats.acquisitions = acquisitions;
+            stats.contentions  = l.contentions.exchange(0, std::memory_order_relaxed);
+            stats.total_wait   = std::chrono::nanoseconds(l.total_wait.exchange(0, std::memory_order_relaxed));
+            stats.max_wait     = std::chrono::nanoseconds(l.max_wait.exchange(0, std::memory_order_relaxed));
+            stats.total_hold   = std::chrono::nanoseconds(l.total_hold.exchange(0, std::memory_order_relaxed));
+            stats.max_hold     = std::chrono::nanoseconds(l.max_hold.exchange(0, std::memory_order_relaxed));
+            summary->locks.push_back(stats);
+        }
+
+        // The locks that were waited on for the longest come first
+        std::sort(summary->locks.begin(),
+                  summary->locks.end(),
+                  [](const message::LockStatistics::Lock& a, const message::LockStatistics::Lock& b) {
+                      return a.total_wait > b.total_wait;
+                  });
+
+        return summary;
+    }
+
+}  // namespace util
+}  // namespace NUClear
@@ -0,0 +1,97 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NUCLEAR_UTIL_LOCKPROFILER_HPP
+#define NUCLEAR_UTIL_LOCKPROFILER_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "../message/LockStatistics.hpp"
+
+namespace NUClear {
+namespace util {
+
+    /**
+     * @brief Counts how long threads wait for and hold each of NUClear's locks.
+     *
+     * @details
+     *  Locks are counted by name, so every lock with the same name (such as the locks of every TypeMap) shares one set
+     *  of counters. Nothing is counted unless NUClear is built with NUCLEAR_PROFILE_LOCKS, which makes util::Mutex a
+     *  ProfiledMutex.
+     */
+    class LockProfiler {
+    public:
+        /// @brief The counters of the locks with one name
+        struct Lock {
+            explicit Lock(std::string name)
+                : name(std::move(name))
+                , acquisitions(0)
+                , contentions(0)
+                , total_wait(0)
+                , max_wait(0)
+                , total_hold(0)
+                , max_hold(0) {}
+
+            /**
+             * @brief Counts the lock being acquired.
+             *
+             * @param wait how long the thread waited for the lock, zero if it did not have to wait
+             */
+            void acquired(const std::chrono::nanoseconds& wait);
+
+            /**
+             * @brief Counts the lock being released.
+             *
+             * @param hold how long the lock was held for
+             */
+            void released(const std::chrono::nanoseconds& hold);
+
+            const std::string name;
+            std::atomic<uint64_t> acquisitions;
+            std::atomic<uint64_t> contentions;
+            std::atomic<int64_t> total_wait;
+            std::atomic<int64_t> max_wait;
+            std::atomic<int64_t> total_hold;
+            std::atomic<int64_t> max_hold;
+        };
+
+        /**
+         * @brief Gets the counters of the locks with this name, creating them the first time.
+         *
+         * @param name the name of the lock
+         *
+         * @return the counters, which live until the program exits
+         */
+        static Lock& find(const std::string& name);
+
+        /**
+         * @brief Collects the counters of every lock since the last summary, most contended first.
+         *
+         * @return the statistics of each lock that was acquired since the last summary
+         */
+        static std::unique_ptr<message::LockStatistics> summarise();
+    };
+
+}  // namespace util
+}  // namespace NUClear
+
+#endif  // NUCLEAR_UTIL_LOCKPROFILER_HPP
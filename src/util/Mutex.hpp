@@ -0,0 +1,150 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NUCLEAR_UTIL_MUTEX_HPP
+#define NUCLEAR_UTIL_MUTEX_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <typeinfo>
+
+#include "LockProfiler.hpp"
+#include "demangle.hpp"
+
+namespace NUClear {
+namespace util {
+
+    /**
+     * @brief Names the types a mutex guards the data of so that each instantiation is profiled on its own.
+     *
+     * @tparam Ts the types that distinguish this mutex from the others with the same name
+     *
+     * @return the demangled names of the types separated by commas
+     */
+    template <typename... Ts>
+    std::string lock_key() {
+        std::string key;
+        for (const char* name : {typeid(Ts).name()...}) {
+            key += (key.empty() ? "" : ", ") + demangle(name);
+        }
+        return key;
+    }
+
+    /**
+     * @brief A mutex that counts how long threads wait for it and hold it in the LockProfiler.
+     *
+     * @details
+     *  Acquiring the mutex without waiting costs reading the clock and updating its counters, the clock is only read a
+     *  second time to time the wait when the mutex is already held. The counters for the mutex's name are looked up
+     *  the first time it is used so that static mutexes can still be constant initialised. Mutexes in templates are
+     *  given a key, usually a lock_key, so that they are counted as name<key> rather than sharing one row.
+     */
+    class ProfiledMutex {
+    public:
+        /// @brief The lock to use when waiting on a condition_variable
+        using unique_lock = std::unique_lock<ProfiledMutex>;
+        /// @brief A condition variable that can wait on this mutex
+        using condition_variable = std::condition_variable_any;
+
+        constexpr explicit ProfiledMutex(const char* name) noexcept
+            : name(name), key(nullptr), profile(nullptr), mutex(), locked() {}
+        constexpr ProfiledMutex(const char* name, std::string (*key)()) noexcept
+            : name(name), key(key), profile(nullptr), mutex(), locked() {}
+
+        ProfiledMutex(const ProfiledMutex&)            = delete;
+        ProfiledMutex& operator=(const ProfiledMutex&) = delete;
+
+        void lock() {
+            if (mutex.try_lock()) {
+                locked = std::chrono::steady_clock::now();
+                counters().acquired(std::chrono::nanoseconds(0));
+            }
+            else {
+                auto start = std::chrono::steady_clock::now();
+                mutex.lock();
+                locked = std::chrono::steady_clock::now();
+                // Never report a wait of zero, as that would count as not having waited
+                counters().acquired(std::max(std::chrono::nanoseconds(1), locked - start));
+            }
+        }
+
+        bool try_lock() {
+            if (!mutex.try_lock()) { return false; }
+            locked = std::chrono::steady_clock::now();
+            counters().acquired(std::chrono::nanoseconds(0));
+            return true;
+        }
+
+        void unlock() {
+            // The time we locked is only safe to read while we still hold the mutex
+            counters().released(std::chrono::steady_clock::now() - locked);
+            mutex.unlock();
+        }
+
+    private:
+        LockProfiler::Lock& counters() {
+            LockProfiler::Lock* p = profile.load(std::memory_order_acquire);
+            if (p == nullptr) {
+                p = &LockProfiler::find(key == nullptr ? name : std::string(name) + "<" + key() + ">");
+                profile.store(p, std::memory_order_release);
+            }
+            return *p;
+        }
+
+        /// The name the mutex is counted under
+        const char* name;
+        /// Describes the types this mutex guards, appended to the name when it is not null
+        std::string (*key)();
+        /// The counters for this name, found the first time they are needed
+        std::atomic<LockProfiler::Lock*> profile;
+        /// The mutex that does the locking
+        std::mutex mutex;
+        /// When the mutex was last locked
+        std::chrono::steady_clock::time_point locked;
+    };
+
+#ifdef NUCLEAR_PROFILE_LOCKS
+    using Mutex = ProfiledMutex;
+#else
+    /**
+     * @brief The mutex NUClear uses internally.
+     *
+     * @details
+     *  This is a std::mutex that takes a name so that when NUClear is built with NUCLEAR_PROFILE_LOCKS it can be
+     *  replaced by a ProfiledMutex. Otherwise the name is ignored, so this costs nothing over a std::mutex.
+     */
+    class Mutex : public std::mutex {
+    public:
+        /// @brief The lock to use when waiting on a condition_variable
+        using unique_lock = std::unique_lock<std::mutex>;
+        /// @brief A condition variable that can wait on this mutex
+        using condition_variable = std::condition_variable;
+
+        constexpr explicit Mutex(const char* /*name*/) noexcept {}
+        constexpr Mutex(const char* /*name*/, std::string (* /*key*/)()) noexcept {}
+    };
+#endif  // NUCLEAR_PROFILE_LOCKS
+
+}  // namespace util
+}  // namespace NUClear
+
+#endif  // NUCLEAR_UTIL_MUTEX_HPP
@@ -0,0 +1,133 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "PerformanceCounters.hpp"
+
+#ifdef __linux__
+#    include <linux/perf_event.h>
+#    include <sys/syscall.h>
+#    include <unistd.h>
+
+#    include <cstring>
+#    include <utility>
+#    include <vector>
+#endif
+
+namespace NUClear {
+namespace util {
+
+#ifdef __linux__
+    namespace {
+
+        /// The perf events of one thread
+        struct ThreadCounters {
+            ThreadCounters() : leader(-1) {
+                add(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES, &PerformanceCounters::cycles, true);
+                add(PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS, &PerformanceCounters::instructions, true);
+                add(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES, &PerformanceCounters::cache_misses, true);
+                add(PERF_TYPE_SOFTWARE, PERF_COUNT_SW_TASK_CLOCK, &PerformanceCounters::task_clock, false);
+                add(PERF_TYPE_SOFTWARE, PERF_COUNT_SW_PAGE_FAULTS, &PerformanceCounters::page_faults, false);
+            }
+
+            ~ThreadCounters() {
+                for (const auto& counter : hardware) {
+                    ::close(counter.first);
+                }
+                for (const auto& counter : software) {
+                    ::close(counter.first);
+                }
+            }
+
+            ThreadCounters(const ThreadCounters&)            = delete;
+            ThreadCounters& operator=(const ThreadCounters&) = delete;
+
+            /**
+             * Opens a counter for this thread.
+             *
+             * Hardware counters are opened as one group so they are scheduled onto the PMU together and can be read
+             * with a single call, the first one that opens leads the group. Software counters are always available
+             * and are opened on their own, as some kernels do not count software events that are not the leader of
+             * their group.
+             */
+            void add(uint32_t type, uint64_t config, uint64_t PerformanceCounters::*field, bool grouped) {
+                perf_event_attr attr;
+                std::memset(&attr, 0, sizeof(attr));
+                attr.size           = sizeof(attr);
+                attr.type           = type;
+                attr.config         = config;
+                attr.read_format    = grouped ? PERF_FORMAT_GROUP : 0;
+                attr.exclude_kernel = 1;
+                attr.exclude_hv     = 1;
+
+                int fd = int(::syscall(SYS_perf_event_open, &attr, 0, -1, grouped ? leader : -1, 0));
+
+                // This counter is not available here
+                if (fd < 0) { return; }
+
+                if (grouped) {
+                    if (leader < 0) { leader = fd; }
+                    hardware.emplace_back(fd, field);
+                }
+                else {
+                    software.emplace_back(fd, field);
+                }
+            }
+
+            /// The file descriptor that reads the whole hardware group
+            int leader;
+            /// The hardware counters and where they go, in the order the group reads them
+            std::vector<std::pair<int, uint64_t PerformanceCounters::*>> hardware;
+            /// The software counters and where they go
+            std::vector<std::pair<int, uint64_t PerformanceCounters::*>> software;
+        };
+
+    }  // namespace
+
+    PerformanceCounters PerformanceCounters::read() {
+
+        thread_local ThreadCounters counters;
+
+        PerformanceCounters result;
+
+        // A group read gives the number of counters followed by each of their values
+        if (counters.leader >= 0) {
+            uint64_t buffer[1 + 3];
+            if (::read(counters.leader, buffer, sizeof(buffer)) >= ssize_t(sizeof(uint64_t))) {
+                for (size_t i = 0; i < buffer[0] && i < counters.hardware.size(); ++i) {
+                    result.*counters.hardware[i].second = buffer[1 + i];
+                }
+            }
+        }
+
+        for (const auto& counter : counters.software) {
+            uint64_t value = 0;
+            if (::read(counter.first, &value, sizeof(value)) == ssize_t(sizeof(value))) {
+                result.*counter.second = value;
+            }
+        }
+
+        return result;
+    }
+#else
+    PerformanceCounters PerformanceCounters::read() {
+        return PerformanceCounters();
+    }
+#endif
+
+}  // namespace util
+}  // namespace NUClear
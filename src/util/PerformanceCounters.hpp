@@ -0,0 +1,74 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NUCLEAR_UTIL_PERFORMANCECOUNTERS_HPP
+#define NUCLEAR_UTIL_PERFORMANCECOUNTERS_HPP
+
+#include <cstdint>
+
+namespace NUClear {
+namespace util {
+
+    /**
+     * @brief Counts of the CPU events of a thread, read from its performance counters.
+     *
+     * @details
+     *  On Linux these are read with perf_event_open. Hardware counters (cycles, instructions and cache misses) are
+     *  often unavailable, such as in virtual machines or when perf_event_paranoid forbids them, in which case they
+     *  read as zero and only the software counters (task clock and page faults) are counted. On other platforms
+     *  everything reads as zero.
+     */
+    struct PerformanceCounters {
+        PerformanceCounters() : cycles(0), instructions(0), cache_misses(0), task_clock(0), page_faults(0) {}
+
+        /// @brief CPU cycles spent running in user space
+        uint64_t cycles;
+        /// @brief Instructions retired in user space
+        uint64_t instructions;
+        /// @brief Last level cache misses
+        uint64_t cache_misses;
+        /// @brief Nanoseconds spent running, as measured by the kernel
+        uint64_t task_clock;
+        /// @brief Page faults
+        uint64_t page_faults;
+
+        PerformanceCounters operator-(const PerformanceCounters& other) const {
+            PerformanceCounters c;
+            c.cycles       = cycles - other.cycles;
+            c.instructions = instructions - other.instructions;
+            c.cache_misses = cache_misses - other.cache_misses;
+            c.task_clock   = task_clock - other.task_clock;
+            c.page_faults  = page_faults - other.page_faults;
+            return c;
+        }
+
+        /**
+         * @brief Reads the counters of the calling thread.
+         *
+         * @details
+         *  The counters are opened the first time each thread reads them, and stay open until the thread exits.
+         *
+         * @return the counts since the counters were opened
+         */
+        static PerformanceCounters read();
+    };
+
+}  // namespace util
+}  // namespace NUClear
+
+#endif  // NUCLEAR_UTIL_PERFORMANCECOUNTERS_HPP
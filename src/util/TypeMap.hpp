@@ -23,6 +23,8 @@
 #include <mutex>
 #include <vector>
 
+#include "Mutex.hpp"
+
 namespace NUClear {
 namespace util {
 
@@ -51,7 +53,7 @@ namespace util {
         /// @brief the data variable where the data is stored for this map key.
 
         static std::shared_ptr<Value> data;
-        static std::mutex mutex;
+        static Mutex mutex;
 
     public:
         /**
@@ -65,7 +67,7 @@ namespace util {
             // std::atomic_store_explicit(&data, d, std::memory_order_relaxed);
 
             // Lock a mutex and set our data
-            std::lock_guard<std::mutex> lock(mutex);
+            std::lock_guard<Mutex> lock(mutex);
             data = std::move(d);
         }
 
@@ -81,7 +83,7 @@ namespace util {
 
             std::shared_ptr<Value> d;
             {
-                std::lock_guard<std::mutex> lock(mutex);
+                std::lock_guard<Mutex> lock(mutex);
                 d = data;
             }
 
@@ -93,7 +95,7 @@ namespace util {
     template <typename MapID, typename Key, typename Value>
     std::shared_ptr<Value> TypeMap<MapID, Key, Value>::data;
     template <typename MapID, typename Key, typename Value>
-    std::mutex TypeMap<MapID, Key, Value>::mutex;
+    Mutex TypeMap<MapID, Key, Value>::mutex("TypeMap", &lock_key<MapID, Key>);
 
 }  // namespace util
 }  // namespace NUClear
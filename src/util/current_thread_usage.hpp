@@ -0,0 +1,83 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NUCLEAR_UTIL_CURRENT_THREAD_USAGE_HPP
+#define NUCLEAR_UTIL_CURRENT_THREAD_USAGE_HPP
+
+#include <chrono>
+#include <cstdint>
+
+#ifdef _WIN32
+#    include "platform.hpp"
+#else
+#    include <sys/resource.h>
+#    include <time.h>
+#endif
+
+namespace NUClear {
+namespace util {
+
+    /// @brief The resources the calling thread has used since it started
+    struct ThreadUsage {
+        ThreadUsage() : cpu_time(0), voluntary_context_switches(0), involuntary_context_switches(0) {}
+
+        /// @brief The CPU time the thread has spent running
+        std::chrono::nanoseconds cpu_time;
+        /// @brief The number of times the thread gave up the CPU, such as to wait for IO or a lock
+        int64_t voluntary_context_switches;
+        /// @brief The number of times the thread was preempted
+        int64_t involuntary_context_switches;
+    };
+
+    /**
+     * @brief Reads the resources the calling thread has used.
+     *
+     * @details
+     *  Context switches are only counted on Linux, elsewhere they are always zero.
+     */
+    inline ThreadUsage current_thread_usage() {
+        ThreadUsage usage;
+
+#ifdef _WIN32
+        FILETIME creation, exit, kernel, user;
+        if (GetThreadTimes(GetCurrentThread(), &creation, &exit, &kernel, &user)) {
+            auto ticks = [](const FILETIME& t) { return (uint64_t(t.dwHighDateTime) << 32) | t.dwLowDateTime; };
+            // FILETIME counts in 100ns intervals
+            usage.cpu_time = std::chrono::nanoseconds((ticks(kernel) + ticks(user)) * 100);
+        }
+#else
+        timespec ts{};
+        if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts) == 0) {
+            usage.cpu_time = std::chrono::seconds(ts.tv_sec) + std::chrono::nanoseconds(ts.tv_nsec);
+        }
+#    ifdef RUSAGE_THREAD
+        rusage ru{};
+        if (getrusage(RUSAGE_THREAD, &ru) == 0) {
+            usage.voluntary_context_switches   = ru.ru_nvcsw;
+            usage.involuntary_context_switches = ru.ru_nivcsw;
+        }
+#    endif
+#endif
+
+        return usage;
+    }
+
+}  // namespace util
+}  // namespace NUClear
+
+#endif  // NUCLEAR_UTIL_CURRENT_THREAD_USAGE_HPP
@@ -0,0 +1,65 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "powerplant_slots.hpp"
+
+#include <mutex>
+#include <vector>
+
+namespace NUClear {
+namespace util {
+
+    namespace {
+
+        /// The functions that clear the state each store keeps for a slot
+        struct Registry {
+            std::mutex mutex;
+            std::vector<void (*)(size_t)> resets;
+        };
+
+        Registry& registry() {
+            // Never destroyed as stores can be used while other static objects are being destroyed
+            static Registry* r = new Registry();
+            return *r;
+        }
+
+    }  // namespace
+
+    void on_slot_released(void (*reset)(size_t)) {
+        Registry& r = registry();
+        std::lock_guard<std::mutex> lock(r.mutex);
+        r.resets.push_back(reset);
+    }
+
+    void reset_slot(size_t slot) {
+
+        // Take a copy so that a store registering itself while we are resetting can't deadlock
+        std::vector<void (*)(size_t)> resets;
+        /* Mutex Scope */ {
+            Registry& r = registry();
+            std::lock_guard<std::mutex> lock(r.mutex);
+            resets = r.resets;
+        }
+
+        for (auto& reset : resets) {
+            reset(slot);
+        }
+    }
+
+}  // namespace util
+}  // namespace NUClear
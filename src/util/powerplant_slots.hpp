@@ -0,0 +1,68 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NUCLEAR_UTIL_POWERPLANT_SLOTS_HPP
+#define NUCLEAR_UTIL_POWERPLANT_SLOTS_HPP
+
+#include <cstddef>
+
+namespace NUClear {
+namespace util {
+
+    /**
+     * @brief The number of PowerPlants that can exist in this process at the same time.
+     *
+     * @details Each PowerPlant is given a slot index when it is constructed. The stores that need to keep separate
+     *          state for each PowerPlant hold a fixed array of this many entries, so finding the state for a
+     *          PowerPlant is still a direct index rather than a lookup.
+     */
+    constexpr size_t max_powerplants = 16;
+
+    /**
+     * @brief Registers a function that clears the state that a store keeps for a slot.
+     *
+     * @details Stores that keep state for each PowerPlant register themselves the first time they are used. When a
+     *          PowerPlant is destroyed each of these functions is called with its slot, so the next PowerPlant that is
+     *          given the slot starts out empty rather than with the data of the PowerPlant before it.
+     *
+     * @param reset the function that clears the state for the slot that it is passed
+     */
+    void on_slot_released(void (*reset)(size_t));
+
+    /**
+     * @brief Clears the state that every store keeps for a slot.
+     *
+     * @param slot the slot of the PowerPlant that is being destroyed
+     */
+    void reset_slot(size_t slot);
+
+    /**
+     * @brief Registers a reset function when it is constructed.
+     *
+     * @details This is used as a function local static in the stores, so that each store only registers once.
+     */
+    struct SlotReset {
+        explicit SlotReset(void (*reset)(size_t)) {
+            on_slot_released(reset);
+        }
+    };
+
+}  // namespace util
+}  // namespace NUClear
+
+#endif  // NUCLEAR_UTIL_POWERPLANT_SLOTS_HPP
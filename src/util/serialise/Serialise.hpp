@@ -19,8 +19,10 @@
 #ifndef NUCLEAR_UTIL_SERIALISE_SERIALISE_HPP
 #define NUCLEAR_UTIL_SERIALISE_SERIALISE_HPP
 
+#include <cstring>
 #include <string>
 #include <type_traits>
+#include <vector>
 
 #include "../demangle.hpp"
 #include "xxhash.h"
@@ -53,10 +55,28 @@ namespace util {
                 return std::vector<char>(dataptr, dataptr + sizeof(T));
             }
 
+            static inline size_t size(const T&) {
+                return sizeof(T);
+            }
+
+            static inline void serialise(const T& in, char* out) {
+
+                // Copy the bytes straight into the output
+                std::memcpy(out, &in, sizeof(T));
+            }
+
             static inline T deserialise(const std::vector<char>& in) {
 
                 // Copy the data into an object of the correct type
-                T ret = *reinterpret_cast<T*>(in.data());
+                T ret = *reinterpret_cast<const T*>(in.data());
+                return ret;
+            }
+
+            static inline T deserialise(const char* in, size_t) {
+
+                // The input may not be aligned for T so copy it byte by byte
+                T ret;
+                std::memcpy(&ret, in, sizeof(T));
                 return ret;
             }
 
@@ -91,13 +111,28 @@ namespace util {
                 return out;
             }
 
+            static inline size_t size(const T& in) {
+                return std::size_t(std::distance(in.begin(), in.end())) * sizeof(StoredType);
+            }
+
+            static inline void serialise(const T& in, char* out) {
+                for (const StoredType& item : in) {
+                    std::memcpy(out, &item, sizeof(StoredType));
+                    out += sizeof(StoredType);
+                }
+            }
+
             static inline T deserialise(const std::vector<char>& in) {
+                return deserialise(in.data(), in.size());
+            }
+
+            static inline T deserialise(const char* in, size_t size) {
 
                 T out;
 
-                const StoredType* data = reinterpret_cast<const StoredType*>(in.data());
+                const StoredType* data = reinterpret_cast<const StoredType*>(in);
 
-                out.insert(out.end(), data, data + (in.size() / sizeof(StoredType)));
+                out.insert(out.end(), data, data + (size / sizeof(StoredType)));
 
                 return out;
             }
@@ -124,12 +159,24 @@ namespace util {
                 return output;
             }
 
+            static inline size_t size(const T& in) {
+                return in.ByteSize();
+            }
+
+            static inline void serialise(const T& in, char* out) {
+                in.SerializeToArray(out, in.ByteSize());
+            }
+
             static inline T deserialise(const std::vector<char>& in) {
+                return deserialise(in.data(), in.size());
+            }
+
+            static inline T deserialise(const char* in, size_t size) {
                 // Make a buffer
                 T out;
 
                 // Deserialize it
-                out.ParseFromArray(in.data(), in.size());
+                out.ParseFromArray(in, size);
                 return out;
             }
 
@@ -0,0 +1,59 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NUCLEAR_UTIL_UPDATE_CURRENT_THREAD_AFFINITY_HPP
+#define NUCLEAR_UTIL_UPDATE_CURRENT_THREAD_AFFINITY_HPP
+
+#include <vector>
+
+#if defined(__linux__)
+
+#    include <pthread.h>
+#    include <sched.h>
+
+inline void update_current_thread_affinity(const std::vector<unsigned int>& cpus) {
+
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (const auto& cpu : cpus) {
+        CPU_SET(cpu, &set);
+    }
+    pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+}
+
+#elif defined(_WIN32)
+
+#    include "nuclear_bits/util/windows_includes.hpp"
+
+inline void update_current_thread_affinity(const std::vector<unsigned int>& cpus) {
+
+    DWORD_PTR mask = 0;
+    for (const auto& cpu : cpus) {
+        if (cpu < sizeof(mask) * 8) { mask |= DWORD_PTR(1) << cpu; }
+    }
+    SetThreadAffinityMask(GetCurrentThread(), mask);
+}
+
+#else
+
+// Other platforms (such as OSX) do not let threads be pinned to CPUs so this is only a hint that we ignore
+inline void update_current_thread_affinity(const std::vector<unsigned int>&) {}
+
+#endif
+
+#endif  // NUCLEAR_UTIL_UPDATE_CURRENT_THREAD_AFFINITY_HPP
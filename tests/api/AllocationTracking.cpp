@@ -0,0 +1,86 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <catch.hpp>
+#include <nuclear>
+#include <vector>
+
+namespace {
+
+struct Allocate {};
+struct Quiet {};
+
+std::vector<std::vector<char>> blocks;
+NUClear::message::ReactionStatistics allocating_stats;
+NUClear::message::ReactionStatistics quiet_stats;
+int seen = 0;
+
+class TestReactor : public NUClear::Reactor {
+public:
+    TestReactor(std::unique_ptr<NUClear::Environment> environment) : Reactor(std::move(environment)) {
+
+        on<Trigger<Allocate>>().then("Allocating", [] {
+            for (int i = 0; i < 10; ++i) {
+                blocks.emplace_back(1000);
+            }
+        });
+
+        on<Trigger<Quiet>>().then("Quiet", [] {});
+
+        on<Trigger<NUClear::message::ReactionStatistics>>().then(
+            [this](const NUClear::message::ReactionStatistics& stats) {
+                if (stats.identifier[0] == "Allocating") { allocating_stats = stats; }
+                else if (stats.identifier[0] == "Quiet") {
+                    quiet_stats = stats;
+                }
+                else {
+                    return;
+                }
+
+                if (++seen == 2) { powerplant.shutdown(); }
+            });
+
+        on<Startup>().then([this] {
+            emit(std::make_unique<Allocate>());
+            emit(std::make_unique<Quiet>());
+        });
+    }
+};
+}  // namespace
+
+TEST_CASE("Testing counting the memory allocations of reactions", "[api][allocations]") {
+
+    NUClear::PowerPlant::Configuration config;
+    config.thread_count = 1;
+    NUClear::PowerPlant plant(config);
+    plant.install<TestReactor>();
+    plant.start();
+
+    // A reaction that doesn't allocate has nothing counted against it
+    REQUIRE(quiet_stats.allocations.allocations == 0);
+    REQUIRE(quiet_stats.allocations.bytes == 0);
+
+    if (NUClear::util::AllocationCounters::enabled()) {
+        REQUIRE(allocating_stats.allocations.allocations >= 10);
+        REQUIRE(allocating_stats.allocations.bytes >= 10 * 1000);
+    }
+    else {
+        REQUIRE(allocating_stats.allocations.allocations == 0);
+        REQUIRE(allocating_stats.allocations.bytes == 0);
+    }
+}
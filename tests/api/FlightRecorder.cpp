@@ -0,0 +1,88 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <catch.hpp>
+#include <nuclear>
+#include <sstream>
+
+// Anonymous namespace to keep everything file local
+namespace {
+
+struct Message {};
+
+int handled = 0;
+
+class TestReactor : public NUClear::Reactor {
+public:
+    TestReactor(std::unique_ptr<NUClear::Environment> environment) : Reactor(std::move(environment)) {
+
+        on<Trigger<Message>, Sync<TestReactor>>().then([this] {
+            if (++handled == 10) { powerplant.shutdown(); }
+        });
+
+        on<Startup>().then([this] {
+            for (int i = 0; i < 10; ++i) {
+                emit(std::make_unique<Message>());
+            }
+        });
+    }
+};
+}  // namespace
+
+TEST_CASE("Testing the flight recorder records scheduler events", "[api][flightrecorder]") {
+
+    NUClear::PowerPlant::Configuration config;
+    config.thread_count = 2;
+    NUClear::PowerPlant plant(config);
+    plant.install<TestReactor>();
+    plant.start();
+
+    std::stringstream stream;
+    NUClear::util::FlightRecorder::dump(stream);
+    std::string dump = stream.str();
+
+    for (const char* event : {"SUBMIT", "DEQUEUE", "START", "FINISH", "SYNC_RELEASE"}) {
+        INFO(event);
+        REQUIRE(dump.find(event) != std::string::npos);
+    }
+}
+
+TEST_CASE("Testing the flight recorder only keeps the latest events", "[api][flightrecorder]") {
+
+    using NUClear::util::FlightRecorder;
+
+    // Fill our ring many times over with events that nothing else records
+    for (size_t i = 0; i < FlightRecorder::CAPACITY * 3; ++i) {
+        FlightRecorder::record(FlightRecorder::Event::WAKE, 0, 1000000000 + i);
+    }
+
+    std::stringstream stream;
+    FlightRecorder::dump(stream);
+
+    // Other threads' rings hold real task ids, so only count the ids we recorded
+    size_t kept     = 0;
+    bool has_latest = false;
+    std::string line;
+    while (std::getline(stream, line)) {
+        uint64_t task = std::stoull(line.substr(line.rfind(' ') + 1));
+        if (task >= 1000000000 && task < 1000000000 + FlightRecorder::CAPACITY * 3) { ++kept; }
+        if (task == 1000000000 + FlightRecorder::CAPACITY * 3 - 1) { has_latest = true; }
+    }
+    REQUIRE(kept == FlightRecorder::CAPACITY - 1);
+    REQUIRE(has_latest);
+}
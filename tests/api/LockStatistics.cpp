@@ -0,0 +1,135 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <atomic>
+#include <catch.hpp>
+#include <nuclear>
+#include <thread>
+
+namespace {
+
+using NUClear::message::LockStatistics;
+
+const LockStatistics::Lock* find(const LockStatistics& stats, const std::string& name) {
+    for (const auto& lock : stats.locks) {
+        if (lock.name.find(name) != std::string::npos) { return &lock; }
+    }
+    return nullptr;
+}
+
+#ifdef NUCLEAR_PROFILE_LOCKS
+struct Message {};
+struct Group {};
+
+bool seen_group = false;
+
+class TestReactor : public NUClear::Reactor {
+public:
+    TestReactor(std::unique_ptr<NUClear::Environment> environment) : Reactor(std::move(environment)) {
+
+        // Each task holds the group long enough that the others must queue behind it
+        on<Trigger<Message>, Sync<Group>>().then([] { std::this_thread::sleep_for(std::chrono::milliseconds(5)); });
+
+        on<Trigger<LockStatistics>>().then([this](const LockStatistics& stats) {
+            for (size_t i = 1; i < stats.locks.size(); ++i) {
+                REQUIRE(stats.locks[i - 1].total_wait >= stats.locks[i].total_wait);
+            }
+
+            const LockStatistics::Lock* group = find(stats, "Sync<");
+            if (group != nullptr && group->contentions > 0) {
+                REQUIRE(group->max_hold >= std::chrono::milliseconds(5));
+                seen_group = true;
+                powerplant.shutdown();
+            }
+        });
+
+        on<Startup>().then([this] {
+            for (int i = 0; i < 4; ++i) {
+                emit(std::make_unique<Message>());
+            }
+        });
+    }
+};
+#endif  // NUCLEAR_PROFILE_LOCKS
+}  // namespace
+
+TEST_CASE("Testing a profiled mutex counts waiting and holding", "[api][lockstatistics]") {
+
+    NUClear::util::ProfiledMutex mutex("Test Lock");
+    std::atomic<bool> waiting(false);
+
+    mutex.lock();
+    std::thread other([&] {
+        waiting = true;
+        mutex.lock();
+        mutex.unlock();
+    });
+
+    // Hold the lock until the other thread is definitely waiting for it
+    while (!waiting) {
+        std::this_thread::yield();
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    mutex.unlock();
+    other.join();
+
+    auto stats                       = NUClear::util::LockProfiler::summarise();
+    const LockStatistics::Lock* lock = find(*stats, "Test Lock");
+    REQUIRE(lock != nullptr);
+    REQUIRE(lock->acquisitions == 2);
+    REQUIRE(lock->contentions == 1);
+    REQUIRE(lock->total_wait > std::chrono::nanoseconds(0));
+    REQUIRE(lock->max_hold >= std::chrono::milliseconds(10));
+
+    // Each summary only holds what happened since the last one
+    stats = NUClear::util::LockProfiler::summarise();
+    REQUIRE(find(*stats, "Test Lock") == nullptr);
+}
+
+TEST_CASE("Testing profiled mutexes with keys are counted separately", "[api][lockstatistics]") {
+
+    NUClear::util::ProfiledMutex ints("Keyed Lock", &NUClear::util::lock_key<int>);
+    NUClear::util::ProfiledMutex doubles("Keyed Lock", &NUClear::util::lock_key<double, int>);
+
+    ints.lock();
+    ints.unlock();
+    doubles.lock();
+    doubles.unlock();
+    doubles.lock();
+    doubles.unlock();
+
+    auto stats = NUClear::util::LockProfiler::summarise();
+    REQUIRE(find(*stats, "Keyed Lock<int>") != nullptr);
+    REQUIRE(find(*stats, "Keyed Lock<int>")->acquisitions == 1);
+    REQUIRE(find(*stats, "Keyed Lock<double, int>") != nullptr);
+    REQUIRE(find(*stats, "Keyed Lock<double, int>")->acquisitions == 2);
+}
+
+#ifdef NUCLEAR_PROFILE_LOCKS
+TEST_CASE("Testing lock statistics are reported for contended Sync groups", "[api][lockstatistics][sync]") {
+
+    NUClear::PowerPlant::Configuration config;
+    config.thread_count      = 4;
+    config.statistics_period = std::chrono::milliseconds(50);
+    NUClear::PowerPlant plant(config);
+    plant.install<TestReactor>();
+    plant.start();
+
+    REQUIRE(seen_group);
+}
+#endif  // NUCLEAR_PROFILE_LOCKS
@@ -0,0 +1,94 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <catch.hpp>
+#include <nuclear>
+
+// Anonymous namespace to keep everything file local
+namespace {
+
+struct StartTest {};
+
+std::vector<int> squares;
+long long sum_of_squares = 0;
+std::string concatenated;
+std::atomic<int> nested_counter(0);
+bool caught_exception = false;
+
+class TestReactor : public NUClear::Reactor {
+public:
+    TestReactor(std::unique_ptr<NUClear::Environment> environment) : Reactor(std::move(environment)) {
+
+        on<Trigger<StartTest>>().then([this] {
+            // Fill a vector in parallel
+            squares.resize(1000);
+            powerplant.parallel_for(0, 1000, 16, [](int i) { squares[i] = i * i; });
+
+            // Sum it in parallel
+            sum_of_squares = powerplant.parallel_reduce(
+                0, 1000, 16, 0LL, [](int i) { return (long long) squares[i]; }, std::plus<long long>());
+
+            // The reduction must keep the order of the chunks
+            concatenated = powerplant.parallel_reduce(
+                0,
+                10,
+                3,
+                std::string(),
+                [](int i) { return std::to_string(i); },
+                [](std::string a, std::string b) { return a + b; });
+
+            // Parallel loops inside parallel loops must not deadlock the pool
+            powerplant.parallel_for(0, 8, 1, [this](int) {
+                powerplant.parallel_for(0, 8, 1, [](int) { ++nested_counter; });
+            });
+
+            // Exceptions are passed back to the caller
+            try {
+                powerplant.parallel_for(0, 100, 1, [](int i) {
+                    if (i == 50) { throw std::runtime_error("Exception in a parallel loop"); }
+                });
+            }
+            catch (const std::runtime_error&) {
+                caught_exception = true;
+            }
+
+            powerplant.shutdown();
+        });
+
+        on<Startup>().then([this] { emit(std::make_unique<StartTest>()); });
+    }
+};
+}  // namespace
+
+TEST_CASE("Testing the parallel loop functions", "[api][parallel]") {
+
+    NUClear::PowerPlant::Configuration config;
+    config.thread_count = 2;
+    NUClear::PowerPlant plant(config);
+    plant.install<TestReactor>();
+
+    plant.start();
+
+    for (int i = 0; i < 1000; ++i) {
+        REQUIRE(squares[i] == i * i);
+    }
+    REQUIRE(sum_of_squares == 332833500LL);
+    REQUIRE(concatenated == "0123456789");
+    REQUIRE(nested_counter == 64);
+    REQUIRE(caught_exception);
+}
@@ -0,0 +1,156 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <catch.hpp>
+#include <nuclear>
+
+// Anonymous namespace to keep everything file local
+namespace {
+
+struct Seed {
+    Seed(size_t plant) : plant(plant) {}
+    size_t plant;
+};
+
+struct Value {
+    Value(int value) : value(value) {}
+    int value;
+};
+
+struct Result {
+    std::vector<size_t> seeds;
+    std::vector<int> values;
+    std::vector<std::thread::id> main_threads;
+};
+
+std::mutex mutex;
+std::map<size_t, Result> results;
+
+class TestReactor : public NUClear::Reactor {
+public:
+    TestReactor(std::unique_ptr<NUClear::Environment> environment) : Reactor(std::move(environment)) {
+
+        on<Trigger<Value>, With<Seed>>().then([this](const Value& value, const Seed& seed) {
+            std::lock_guard<std::mutex> lock(mutex);
+            auto& result = results[powerplant.id];
+            result.seeds.push_back(seed.plant);
+            result.values.push_back(value.value);
+
+            if (result.values.size() == 100) { powerplant.shutdown(); }
+        });
+
+        on<Trigger<Seed>, MainThread>().then([this] {
+            std::lock_guard<std::mutex> lock(mutex);
+            results[powerplant.id].main_threads.push_back(std::this_thread::get_id());
+        });
+
+        on<Startup>().then([this] {
+            emit(std::make_unique<Seed>(powerplant.id));
+            for (int i = 0; i < 100; ++i) {
+                emit(std::make_unique<Value>(int(powerplant.id) * 1000 + i));
+            }
+        });
+    }
+};
+
+struct Calibration {
+    Calibration(int offset) : offset(offset) {}
+    int offset;
+};
+
+std::vector<size_t> sequential_ids;
+std::vector<int> sequential_offsets;
+std::vector<size_t> sequential_history;
+
+class SequentialReactor : public NUClear::Reactor {
+public:
+    SequentialReactor(std::unique_ptr<NUClear::Environment> environment) : Reactor(std::move(environment)) {
+
+        on<Trigger<Value>, With<History<5, Value>>>().then(
+            [](const Value&, const History<5, Value>& history) { sequential_history.push_back(history.size()); });
+
+        on<Startup, Optional<With<Calibration>>>().then([this](std::shared_ptr<const Calibration> calibration) {
+            sequential_ids.push_back(powerplant.id);
+            sequential_offsets.push_back(calibration ? calibration->offset : -1);
+
+            emit(std::make_unique<Calibration>(5));
+            emit(std::make_unique<Value>(1));
+            powerplant.shutdown();
+        });
+    }
+};
+}  // namespace
+
+TEST_CASE("Testing running several PowerPlants at the same time", "[api][powerplant]") {
+
+    NUClear::PowerPlant::Configuration config;
+    config.thread_count = 1;
+    config.cpu_affinity = {0};
+
+    NUClear::PowerPlant a(config);
+    NUClear::PowerPlant b(config);
+    a.install<TestReactor>();
+    b.install<TestReactor>();
+
+    // Each powerplant has its own slot, and the first one is used when we can't tell which to use
+    REQUIRE(a.id != b.id);
+    REQUIRE(NUClear::PowerPlant::powerplant == &a);
+
+    std::thread::id b_main;
+    std::thread thread([&b, &b_main] {
+        b_main = std::this_thread::get_id();
+        b.start();
+    });
+    a.start();
+    thread.join();
+
+    // Each powerplant should only have seen its own data
+    for (auto* plant : {&a, &b}) {
+        auto& result = results[plant->id];
+        REQUIRE(result.values.size() == 100);
+        REQUIRE(std::count(result.seeds.begin(), result.seeds.end(), plant->id) == 100);
+
+        std::sort(result.values.begin(), result.values.end());
+        for (int i = 0; i < 100; ++i) {
+            REQUIRE(result.values[i] == int(plant->id) * 1000 + i);
+        }
+    }
+
+    // MainThread tasks run on the thread that started their powerplant
+    REQUIRE(results[a.id].main_threads == std::vector<std::thread::id>({std::this_thread::get_id()}));
+    REQUIRE(results[b.id].main_threads == std::vector<std::thread::id>({b_main}));
+}
+
+TEST_CASE("Testing PowerPlants that reuse the slot of a destroyed PowerPlant", "[api][powerplant][sequential]") {
+
+    for (int i = 0; i < 2; ++i) {
+        NUClear::PowerPlant::Configuration config;
+        config.thread_count = 1;
+        NUClear::PowerPlant plant(config);
+        plant.install<SequentialReactor>();
+        plant.start();
+    }
+
+    // The second powerplant was given the same slot as the first
+    REQUIRE(sequential_ids.size() == 2);
+    REQUIRE(sequential_ids[0] == sequential_ids[1]);
+
+    // But it did not see any of the data that the first powerplant left behind
+    REQUIRE(sequential_offsets == std::vector<int>({-1, -1}));
+    REQUIRE(sequential_history == std::vector<size_t>({1, 1}));
+}
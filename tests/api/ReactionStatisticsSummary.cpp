@@ -0,0 +1,118 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <catch.hpp>
+#include <nuclear>
+// Anonymous namespace to keep everything file local
+namespace {
+
+struct Message {};
+
+bool seen_statistics = false;
+uint64_t handled     = 0;
+uint64_t exceptions  = 0;
+
+using NUClear::message::ReactionStatistics;
+using NUClear::message::ReactionStatisticsSummary;
+
+class TestReactor : public NUClear::Reactor {
+public:
+    TestReactor(std::unique_ptr<NUClear::Environment> environment) : Reactor(std::move(environment)) {
+
+        on<Trigger<ReactionStatistics>>().then([](const ReactionStatistics&) {
+            // Sampling is turned off so no task should emit its statistics
+            seen_statistics = true;
+        });
+
+        on<Trigger<ReactionStatisticsSummary>>().then([this](const ReactionStatisticsSummary& summary) {
+            REQUIRE(summary.start <= summary.end);
+
+            for (const auto& reaction : summary.reactions) {
+                REQUIRE(reaction.count > 0);
+                REQUIRE(reaction.min_runtime <= reaction.max_runtime);
+                REQUIRE(reaction.total_runtime >= reaction.max_runtime);
+                REQUIRE(reaction.runtime_histogram.count() == reaction.count);
+                REQUIRE(reaction.wait_histogram.count() == reaction.count);
+                REQUIRE(reaction.runtime_histogram.percentile(50) <= reaction.runtime_histogram.percentile(99));
+                REQUIRE(reaction.runtime_histogram.percentile(99) <= reaction.runtime_histogram.max());
+
+                if (reaction.identifier[0] == "Message Handler") {
+                    handled += reaction.count;
+                    exceptions += reaction.exceptions;
+                }
+            }
+
+            if (handled == 10) { powerplant.shutdown(); }
+        });
+
+        on<Trigger<Message>>().then("Message Handler", [] { throw std::runtime_error("Every message fails"); });
+
+        on<Startup>().then([this] {
+            for (int i = 0; i < 10; ++i) {
+                emit(std::make_unique<Message>());
+            }
+        });
+    }
+};
+}  // namespace
+
+TEST_CASE("Testing summarised reaction statistics", "[api][reactionstatistics][summary]") {
+
+    NUClear::PowerPlant::Configuration config;
+    config.thread_count           = 1;
+    config.statistics_period      = std::chrono::milliseconds(10);
+    config.statistics_sample_rate = 0;
+    NUClear::PowerPlant plant(config);
+    plant.install<TestReactor>();
+
+    plant.start();
+
+    REQUIRE_FALSE(seen_statistics);
+    REQUIRE(handled == 10);
+    REQUIRE(exceptions == 10);
+}
+
+TEST_CASE("Testing latency histogram percentiles", "[api][reactionstatistics][histogram]") {
+
+    using NUClear::util::LatencyHistogram;
+
+    // Every bucket holds the durations between its lowest and highest
+    for (size_t i = 0; i + 1 < LatencyHistogram::BUCKETS; ++i) {
+        REQUIRE(LatencyHistogram::bucket(LatencyHistogram::lowest(i)) == i);
+        REQUIRE(LatencyHistogram::bucket(LatencyHistogram::highest(i)) == i);
+        REQUIRE(LatencyHistogram::highest(i) + std::chrono::nanoseconds(1) == LatencyHistogram::lowest(i + 1));
+    }
+
+    // Split the durations over two histograms to check they merge
+    LatencyHistogram a;
+    LatencyHistogram b;
+    for (int i = 1; i <= 1000; ++i) {
+        (i % 2 == 0 ? a : b).record(std::chrono::microseconds(i));
+    }
+    a.merge(b);
+
+    auto near = [](const NUClear::clock::duration& value, const std::chrono::microseconds& expected) {
+        return std::abs(double((value - expected).count()) / NUClear::clock::duration(expected).count()) < 0.04;
+    };
+
+    REQUIRE(a.count() == 1000);
+    REQUIRE(near(a.percentile(50), std::chrono::microseconds(500)));
+    REQUIRE(near(a.percentile(99), std::chrono::microseconds(990)));
+    REQUIRE(near(a.percentile(99.9), std::chrono::microseconds(999)));
+    REQUIRE(near(a.max(), std::chrono::microseconds(1000)));
+}
@@ -0,0 +1,81 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <catch.hpp>
+#include <cstdio>
+#include <fstream>
+#include <nuclear>
+#include <sstream>
+
+// Anonymous namespace to keep everything file local
+namespace {
+
+template <int id>
+struct Message {};
+
+const char* trace_path = "nuclear_trace_test.json";
+
+using NUClear::message::TraceConfiguration;
+
+class TestReactor : public NUClear::Reactor {
+public:
+    TestReactor(std::unique_ptr<NUClear::Environment> environment) : Reactor(std::move(environment)) {
+
+        emit<Scope::INITIALIZE>(std::make_unique<TraceConfiguration>(trace_path));
+
+        on<Startup>().then("Startup Handler", [this] { emit(std::make_unique<Message<0>>()); });
+
+        on<Trigger<Message<0>>>().then("First Handler", [this] { emit(std::make_unique<Message<1>>()); });
+
+        on<Trigger<Message<1>>>().then("Second Handler", [this] {
+            // Stop tracing which writes the trace, then finish
+            emit(std::make_unique<TraceConfiguration>());
+            emit(std::make_unique<Message<2>>());
+        });
+
+        on<Trigger<Message<2>>>().then("Untraced Handler", [this] { powerplant.shutdown(); });
+    }
+};
+}  // namespace
+
+TEST_CASE("Testing tracing reactions to a Chrome trace", "[api][trace]") {
+
+    std::remove(trace_path);
+
+    NUClear::PowerPlant::Configuration config;
+    config.thread_count = 1;
+    NUClear::PowerPlant plant(config);
+    plant.install<TestReactor>();
+    plant.start();
+
+    std::ifstream file(trace_path);
+    std::stringstream stream;
+    stream << file.rdbuf();
+    std::string trace = stream.str();
+    file.close();
+    std::remove(trace_path);
+
+    REQUIRE(trace.find("\"traceEvents\"") != std::string::npos);
+    REQUIRE(trace.find("\"name\":\"First Handler\"") != std::string::npos);
+    REQUIRE(trace.find("\"name\":\"Second Handler\"") != std::string::npos);
+    REQUIRE(trace.find("\"ph\":\"s\"") != std::string::npos);
+    REQUIRE(trace.find("\"ph\":\"f\"") != std::string::npos);
+
+    // Nothing after tracing stopped is recorded
+    REQUIRE(trace.find("Untraced Handler") == std::string::npos);
+}
@@ -0,0 +1,143 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <atomic>
+#include <iomanip>
+#include <iostream>
+#include <nuclear>
+
+// Measures the cost of fanning a message out to many subscribers.
+// Every copy of a message's std::shared_ptr is an atomic operation on a reference count that all of the subscribers
+// share. This counts how many times each task copies the data it gathered after gathering it (which is how many extra
+// reference count increments it makes for each message), and times how long delivering to each subscriber takes.
+namespace {
+
+constexpr int n_subscribers = 30;
+constexpr int n_messages    = 20000;
+
+struct Message {
+    int value;
+};
+
+std::atomic<int> completed(0);
+std::atomic<int> copies(0);
+
+// Data that counts how often the task that gathered it copies it
+struct Counted {
+    Counted() = default;
+    Counted(const Counted&) {
+        ++copies;
+    }
+    Counted(Counted&&) = default;
+    Counted& operator=(const Counted&) {
+        ++copies;
+        return *this;
+    }
+    Counted& operator=(Counted&&) = default;
+
+    operator bool() const {
+        return true;
+    }
+};
+
+struct CountCopies {
+    template <typename DSL>
+    static inline Counted get(NUClear::threading::Reaction& /*unused*/) {
+        return Counted();
+    }
+};
+
+class CopyReactor : public NUClear::Reactor {
+public:
+    CopyReactor(std::unique_ptr<NUClear::Environment> environment) : Reactor(std::move(environment)) {
+
+        on<Trigger<Message>, CountCopies>().then([this](const Message& m) {
+            if (m.value == n_messages - 1) { powerplant.shutdown(); }
+        });
+
+        on<Startup>().then([this] {
+            for (int i = 0; i < n_messages; ++i) {
+                emit(std::make_unique<Message>(Message{i}));
+            }
+        });
+    }
+};
+
+double copies_per_task() {
+    copies = 0;
+
+    NUClear::PowerPlant::Configuration config;
+    config.thread_count = 1;
+    NUClear::PowerPlant plant(config);
+    plant.install<CopyReactor>();
+    plant.start();
+
+    return double(copies) / n_messages;
+}
+
+class FanoutReactor : public NUClear::Reactor {
+public:
+    FanoutReactor(std::unique_ptr<NUClear::Environment> environment) : Reactor(std::move(environment)) {
+
+        for (int i = 0; i < n_subscribers; ++i) {
+            on<Trigger<Message>>().then([](const Message&) { ++completed; });
+        }
+
+        on<Startup>().then([this] {
+            for (int i = 0; i < n_messages; ++i) {
+                emit(std::make_unique<Message>(Message{i}));
+            }
+        });
+
+        on<Every<1, std::chrono::milliseconds>>().then([this] {
+            if (completed == n_subscribers * n_messages) { powerplant.shutdown(); }
+        });
+    }
+};
+
+double ns_per_task() {
+    completed = 0;
+
+    NUClear::PowerPlant::Configuration config;
+    config.thread_count = std::max(2u, std::thread::hardware_concurrency());
+    NUClear::PowerPlant plant(config);
+    plant.install<FanoutReactor>();
+
+    auto start = std::chrono::steady_clock::now();
+    plant.start();
+    auto end = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<double, std::nano>(end - start).count() / (n_subscribers * n_messages);
+}
+}  // namespace
+
+int main() {
+
+    double copied = copies_per_task();
+
+    // Warm up the allocator and threads before measuring
+    ns_per_task();
+    double ns = ns_per_task();
+
+    std::cout << std::fixed << std::setprecision(1);
+    std::cout << "Data copies made by each task: " << copied << std::endl;
+    std::cout << n_messages << " messages to " << n_subscribers << " subscribers: " << ns << " ns per task"
+              << std::endl;
+
+    return 0;
+}
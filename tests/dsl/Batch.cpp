@@ -0,0 +1,102 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <catch.hpp>
+
+#include <nuclear>
+
+namespace {
+
+struct TestMessage {
+    int value;
+
+    TestMessage(int v) : value(v){};
+};
+
+struct Tick {};
+
+std::vector<std::vector<int>> batches;
+std::vector<std::vector<int>> ticked_batches;
+int ticked_window_counter = 0;
+std::vector<int> window_values;
+int window_counter = 0;
+
+class TestReactor : public NUClear::Reactor {
+public:
+    TestReactor(std::unique_ptr<NUClear::Environment> environment) : Reactor(std::move(environment)) {
+
+        on<Batch<3, TestMessage>>().then([](const std::vector<std::shared_ptr<const TestMessage>>& batch) {
+            batches.emplace_back();
+            for (const auto& m : batch) {
+                batches.back().push_back(m->value);
+            }
+        });
+
+        // Ticks should not release a partial batch or end a window early
+        on<Batch<3, TestMessage>, Trigger<Tick>>().then(
+            [](const std::vector<std::shared_ptr<const TestMessage>>& batch, const Tick&) {
+                ticked_batches.emplace_back();
+                for (const auto& m : batch) {
+                    ticked_batches.back().push_back(m->value);
+                }
+            });
+
+        on<Window<50, std::chrono::milliseconds, TestMessage>, Trigger<Tick>>().then(
+            [](const std::vector<std::shared_ptr<const TestMessage>>&, const Tick&) { ++ticked_window_counter; });
+
+        on<Window<50, std::chrono::milliseconds, TestMessage>>().then(
+            [this](const std::vector<std::shared_ptr<const TestMessage>>& window) {
+                ++window_counter;
+                for (const auto& m : window) {
+                    window_values.push_back(m->value);
+                }
+
+                if (window_values.size() == 10) { powerplant.shutdown(); }
+            });
+
+        on<Startup>().then([this] {
+            emit(std::make_unique<Tick>());
+            for (int i = 1; i <= 10; ++i) {
+                emit(std::make_unique<TestMessage>(i));
+                emit(std::make_unique<Tick>());
+            }
+        });
+    }
+};
+}  // namespace
+
+TEST_CASE("Testing delivering many messages in one task", "[api][batch][window]") {
+
+    NUClear::PowerPlant::Configuration config;
+    config.thread_count = 1;
+    NUClear::PowerPlant plant(config);
+    plant.install<TestReactor>();
+
+    plant.start();
+
+    // The last message is still waiting for its batch to fill
+    REQUIRE(batches == std::vector<std::vector<int>>({{1, 2, 3}, {4, 5, 6}, {7, 8, 9}}));
+    REQUIRE(ticked_batches == std::vector<std::vector<int>>({{1, 2, 3}, {4, 5, 6}, {7, 8, 9}}));
+
+    // All of our messages should arrive in order in (most likely) one window
+    REQUIRE(window_values == std::vector<int>({1, 2, 3, 4, 5, 6, 7, 8, 9, 10}));
+    REQUIRE(window_counter <= 2);
+
+    // Being triggered by ticks should not have ended any windows early
+    REQUIRE(ticked_window_counter <= 2);
+}
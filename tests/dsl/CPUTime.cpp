@@ -0,0 +1,95 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <catch.hpp>
+#include <nuclear>
+#include <thread>
+
+namespace {
+
+struct Busy {};
+struct Sleepy {};
+struct Unmeasured {};
+
+NUClear::message::ReactionStatistics busy_stats;
+NUClear::message::ReactionStatistics sleepy_stats;
+NUClear::message::ReactionStatistics unmeasured_stats;
+int seen = 0;
+
+class TestReactor : public NUClear::Reactor {
+public:
+    TestReactor(std::unique_ptr<NUClear::Environment> environment) : Reactor(std::move(environment)) {
+
+        on<Trigger<Busy>, CPUTime>().then("Busy", [] {
+            // Spin for a while so we use CPU time
+            auto end = std::chrono::steady_clock::now() + std::chrono::milliseconds(20);
+            while (std::chrono::steady_clock::now() < end) {}
+        });
+
+        on<Trigger<Sleepy>, CPUTime>().then("Sleepy", [] {
+            // Sleep so we use almost no CPU time
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        });
+
+        on<Trigger<Unmeasured>>().then("Unmeasured", [] {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        });
+
+        on<Trigger<NUClear::message::ReactionStatistics>>().then(
+            [this](const NUClear::message::ReactionStatistics& stats) {
+                if (stats.identifier[0] == "Busy") { busy_stats = stats; }
+                else if (stats.identifier[0] == "Sleepy") {
+                    sleepy_stats = stats;
+                }
+                else if (stats.identifier[0] == "Unmeasured") {
+                    unmeasured_stats = stats;
+                }
+                else {
+                    return;
+                }
+
+                if (++seen == 3) { powerplant.shutdown(); }
+            });
+
+        on<Startup>().then([this] {
+            emit(std::make_unique<Busy>());
+            emit(std::make_unique<Sleepy>());
+            emit(std::make_unique<Unmeasured>());
+        });
+    }
+};
+}  // namespace
+
+TEST_CASE("Testing measuring the CPU time of reactions", "[api][cputime]") {
+
+    NUClear::PowerPlant::Configuration config;
+    config.thread_count = 1;
+    NUClear::PowerPlant plant(config);
+    plant.install<TestReactor>();
+    plant.start();
+
+    // Spinning uses CPU time (allowing for being preempted) while sleeping uses almost none
+    REQUIRE(busy_stats.cpu_time > std::chrono::milliseconds(5));
+    REQUIRE(sleepy_stats.cpu_time < std::chrono::milliseconds(5));
+    REQUIRE(unmeasured_stats.cpu_time == std::chrono::nanoseconds(0));
+
+#ifdef __linux__
+    // Sleeping gives up the CPU
+    REQUIRE(sleepy_stats.voluntary_context_switches > 0);
+#endif
+}
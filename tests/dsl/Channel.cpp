@@ -0,0 +1,88 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <catch.hpp>
+
+#include <nuclear>
+
+namespace {
+
+struct Go {};
+
+using SmallChannel = NUClear::dsl::word::Channel<int, 16>;
+
+std::vector<int> received;
+std::vector<size_t> drained;
+
+class TestReactor : public NUClear::Reactor {
+public:
+    TestReactor(std::unique_ptr<NUClear::Environment> environment) : Reactor(std::move(environment)) {
+
+        on<Channel<int, 16>>().then([this](const Channel<int, 16>& channel) {
+            drained.push_back(0);
+
+            int value;
+            while (channel.pop(value)) {
+                received.push_back(value);
+                ++drained.back();
+            }
+
+            if (received.size() == 10 && drained.size() == 1) { emit(std::make_unique<Go>()); }
+            if (received.size() == 1000) { powerplant.shutdown(); }
+        });
+
+        on<Trigger<Go>>().then([] {
+            for (int i = 11; i <= 1000; ++i) {
+                // The consumer runs on another thread so we can wait for it to make room
+                while (!SmallChannel::push(i)) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+
+        on<Startup>().then([] {
+            for (int i = 1; i <= 10; ++i) {
+                REQUIRE(SmallChannel::push(i));
+            }
+        });
+    }
+};
+}  // namespace
+
+TEST_CASE("Testing streaming values through a channel", "[api][channel]") {
+
+    NUClear::PowerPlant::Configuration config;
+    config.thread_count = 2;
+    NUClear::PowerPlant plant(config);
+    plant.install<TestReactor>();
+
+    plant.start();
+
+    // Every value should have arrived exactly once and in order
+    REQUIRE(received.size() == 1000);
+    for (int i = 0; i < 1000; ++i) {
+        REQUIRE(received[i] == i + 1);
+    }
+
+    // Everything pushed on startup should have been drained by a single task
+    REQUIRE(drained.front() == 10);
+
+    // The consumer is only woken when the channel becomes non-empty, and never when it has already been drained
+    REQUIRE(drained.size() < 1000);
+    REQUIRE(std::count(drained.begin(), drained.end(), 0) == 0);
+}
@@ -0,0 +1,89 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <catch.hpp>
+
+#include <nuclear>
+
+namespace {
+
+struct TestMessage {
+    int value;
+
+    TestMessage(int v) : value(v){};
+};
+
+struct IsEven {
+    bool operator()(const TestMessage& m) const {
+        return m.value % 2 == 0;
+    }
+};
+
+struct IsMultipleOfThree {
+    bool operator()(const TestMessage& m) const {
+        return m.value % 3 == 0;
+    }
+};
+
+struct Never {
+    bool operator()() const {
+        return false;
+    }
+};
+
+std::vector<int> even_values;
+std::vector<int> both_values;
+int never_counter = 0;
+
+class TestReactor : public NUClear::Reactor {
+public:
+    TestReactor(std::unique_ptr<NUClear::Environment> environment) : Reactor(std::move(environment)) {
+
+        on<Trigger<TestMessage>, Filter<IsEven>>().then([](const TestMessage& m) { even_values.push_back(m.value); });
+
+        on<Trigger<TestMessage>, Filter<IsEven>, Filter<IsMultipleOfThree>>().then(
+            [](const TestMessage& m) { both_values.push_back(m.value); });
+
+        on<Trigger<TestMessage>, Filter<Never>>().then([] { ++never_counter; });
+
+        on<Trigger<TestMessage>>().then([this](const TestMessage& m) {
+            if (m.value == 12) { powerplant.shutdown(); }
+        });
+
+        on<Startup>().then([this] {
+            for (int i = 1; i <= 12; ++i) {
+                emit(std::make_unique<TestMessage>(i));
+            }
+        });
+    }
+};
+}  // namespace
+
+TEST_CASE("Testing filtering data before a task is created", "[api][filter]") {
+
+    NUClear::PowerPlant::Configuration config;
+    config.thread_count = 1;
+    NUClear::PowerPlant plant(config);
+    plant.install<TestReactor>();
+
+    plant.start();
+
+    REQUIRE(even_values == std::vector<int>({2, 4, 6, 8, 10, 12}));
+    REQUIRE(both_values == std::vector<int>({6, 12}));
+    REQUIRE(never_counter == 0);
+}
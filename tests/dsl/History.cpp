@@ -0,0 +1,86 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <catch.hpp>
+#include <nuclear>
+
+namespace {
+
+struct TestMessage {
+    int value;
+
+    TestMessage(int v) : value(v){};
+};
+
+int emit_counter  = 0;
+int long_counter  = 0;
+int short_counter = 0;
+
+class TestReactor : public NUClear::Reactor {
+public:
+    TestReactor(std::unique_ptr<NUClear::Environment> environment) : Reactor(std::move(environment)) {
+
+        on<Trigger<TestMessage>, With<History<5, TestMessage>>>().then(
+            [this](const TestMessage& m, const History<5, TestMessage>& history) {
+                ++long_counter;
+
+                // Our history must be up to 5 long and the newest element is the one that triggered us
+                REQUIRE(int(history.size()) == std::min(5, m.value));
+                REQUIRE(history.back()->value == m.value);
+
+                // Check that our numbers are increasing
+                int i = history.front()->value;
+                for (const auto& h : history) {
+                    REQUIRE(h->value == i);
+                    ++i;
+                }
+
+                // Finish when we get to 20
+                if (m.value < 20) { emit(std::make_unique<TestMessage>(++emit_counter)); }
+                else {
+                    powerplant.shutdown();
+                }
+            });
+
+        on<Trigger<TestMessage>, History<3, TestMessage>>().then(
+            [](const TestMessage& m, std::vector<std::shared_ptr<const TestMessage>> history) {
+                ++short_counter;
+
+                // A longer history for the same type must not change the length of ours
+                REQUIRE(int(history.size()) == std::min(3, m.value));
+                REQUIRE(history.back()->value == m.value);
+                REQUIRE(history.front()->value == m.value - int(history.size()) + 1);
+            });
+
+        on<Startup>().then([this] { emit(std::make_unique<TestMessage>(++emit_counter)); });
+    }
+};
+}  // namespace
+
+TEST_CASE("Testing the history feature", "[api][history]") {
+
+    NUClear::PowerPlant::Configuration config;
+    config.thread_count = 1;
+    NUClear::PowerPlant plant(config);
+    plant.install<TestReactor>();
+
+    plant.start();
+
+    REQUIRE(long_counter == 20);
+    REQUIRE(short_counter == 20);
+}
@@ -0,0 +1,147 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <catch.hpp>
+#include <cstring>
+#include <nuclear>
+
+namespace {
+
+struct TestPod {
+    int value;
+    double scale;
+};
+
+std::vector<int> pods;
+std::vector<std::string> strings;
+std::vector<std::vector<int>> large;
+
+// Large enough to need several slots of the ring
+const int large_size = 300000;
+
+bool done() {
+    return pods.size() == 10 && strings.size() == 1 && large.size() == 1;
+}
+
+class TestReactor : public NUClear::Reactor {
+public:
+    TestReactor(std::unique_ptr<NUClear::Environment> environment) : Reactor(std::move(environment)) {
+
+        on<IPC<TestPod>>().then([this](const IPCSource& source, const TestPod& pod) {
+            // We hear our own messages
+            REQUIRE(source.pid == ::getpid());
+            REQUIRE(pod.scale == 0.5);
+            pods.push_back(pod.value);
+
+            if (done()) { powerplant.shutdown(); }
+        });
+
+        on<IPC<std::string>>().then([this](const std::string& s) {
+            strings.push_back(s);
+
+            if (done()) { powerplant.shutdown(); }
+        });
+
+        on<IPC<std::vector<int>>>().then([this](const std::vector<int>& v) {
+            large.push_back(v);
+
+            if (done()) { powerplant.shutdown(); }
+        });
+
+        // A locally emitted pod should not come through IPC
+        on<Trigger<TestPod>>().then([] { FAIL("IPC reactions should only see IPC emits"); });
+
+        on<Startup>().then([this] {
+            for (int i = 0; i < 10; ++i) {
+                emit<Scope::IPC>(std::make_unique<TestPod>(TestPod{i, 0.5}));
+            }
+            emit<Scope::IPC>(std::make_unique<std::string>("Hello IPC World!"));
+
+            auto v = std::make_unique<std::vector<int>>(large_size);
+            for (int i = 0; i < large_size; ++i) {
+                (*v)[i] = i;
+            }
+            emit<Scope::IPC>(v);
+        });
+    }
+};
+}  // namespace
+
+TEST_CASE("Testing sending messages through shared memory", "[api][ipc]") {
+
+    NUClear::PowerPlant::Configuration config;
+    config.thread_count = 1;
+    NUClear::PowerPlant plant(config);
+    plant.install<TestReactor>();
+
+    plant.start();
+
+    // Every message should arrive once and in order
+    REQUIRE(pods == std::vector<int>({0, 1, 2, 3, 4, 5, 6, 7, 8, 9}));
+    REQUIRE(strings == std::vector<std::string>({"Hello IPC World!"}));
+
+    // Messages that are larger than a slot arrive intact
+    REQUIRE(large.size() == 1);
+    REQUIRE(large.front().size() == size_t(large_size));
+    for (int i = 0; i < large_size; ++i) {
+        if (large.front()[i] != i) { FAIL("Element " << i << " of the large message was " << large.front()[i]); }
+    }
+}
+
+TEST_CASE("Testing that shared memory segments are removed when they are closed", "[api][ipc][cleanup]") {
+
+    const uint64_t hash    = NUClear::util::serialise::Serialise<TestPod>::hash();
+    const std::string name = NUClear::extension::ipc::SharedMemoryRing::segment_name(hash);
+
+    {
+        NUClear::extension::ipc::SharedMemoryRing ring(hash);
+
+        // The segment exists while something has it open
+        int fd = ::shm_open(name.c_str(), O_RDONLY, 0);
+        REQUIRE(fd >= 0);
+        ::close(fd);
+    }
+
+    // And is removed by the last process to close it
+    int fd = ::shm_open(name.c_str(), O_RDONLY, 0);
+    if (fd >= 0) { ::close(fd); }
+    REQUIRE(fd < 0);
+    REQUIRE(errno == ENOENT);
+}
+
+TEST_CASE("Testing that a message that fails to serialise does not block the ring", "[api][ipc]") {
+
+    NUClear::extension::ipc::Doorbell doorbell;
+    NUClear::extension::ipc::SharedMemoryRing ring(0x6e75636c65617231);
+    ring.subscribe(doorbell.id());
+
+    REQUIRE_THROWS_AS(ring.write(4, [](char*) { throw std::runtime_error("Unable to serialise"); }),
+                      std::runtime_error);
+    ring.write(4, [](char* out) { std::memcpy(out, "next", 4); });
+
+    // Readers skip the failed message rather than waiting for it to be written
+    std::vector<std::string> read;
+    ring.read([&](const NUClear::extension::ipc::SharedMemoryRing::Message& message) {
+        read.emplace_back(message.data, message.size);
+    });
+    REQUIRE(read == std::vector<std::string>{"next"});
+}
@@ -0,0 +1,88 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <catch.hpp>
+
+#include <nuclear>
+
+namespace {
+
+struct TestMessage {};
+
+struct Chain {
+    int value;
+
+    Chain(int v) : value(v){};
+};
+
+bool emitting      = false;
+bool inline_during = false;
+bool queued_during = true;
+int nesting        = 0;
+int max_nesting    = 0;
+std::vector<int> chain_values;
+
+class TestReactor : public NUClear::Reactor {
+public:
+    TestReactor(std::unique_ptr<NUClear::Environment> environment) : Reactor(std::move(environment)) {
+
+        // This should run while the emit is still happening
+        on<Trigger<TestMessage>, Inline>().then([] { inline_during = emitting; });
+
+        // This should run after the emitting reaction has finished
+        on<Trigger<TestMessage>>().then([this] {
+            queued_during = emitting;
+            emit(std::make_unique<Chain>(1));
+        });
+
+        // An inline reaction that triggers itself must eventually be queued
+        on<Trigger<Chain>, Inline>().then([this](const Chain& c) {
+            max_nesting = std::max(max_nesting, ++nesting);
+            chain_values.push_back(c.value);
+
+            if (c.value < 20) { emit(std::make_unique<Chain>(c.value + 1)); }
+            else {
+                powerplant.shutdown();
+            }
+            --nesting;
+        });
+
+        on<Startup>().then([this] {
+            emitting = true;
+            emit(std::make_unique<TestMessage>());
+            emitting = false;
+        });
+    }
+};
+}  // namespace
+
+TEST_CASE("Testing running reactions on the emitting thread", "[api][inline]") {
+
+    NUClear::PowerPlant::Configuration config;
+    config.thread_count = 1;
+    NUClear::PowerPlant plant(config);
+    plant.install<TestReactor>();
+
+    plant.start();
+
+    REQUIRE(inline_during);
+    REQUIRE_FALSE(queued_during);
+
+    REQUIRE(chain_values.size() == 20);
+    REQUIRE(max_nesting == NUClear::dsl::word::Inline::max_depth + 1);
+}
@@ -0,0 +1,157 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <catch.hpp>
+
+#include <nuclear>
+
+namespace {
+
+struct Left {
+    int value;
+
+    Left(int v) : value(v){};
+};
+
+struct Right {
+    int value;
+
+    Right(int v) : value(v){};
+};
+
+struct Extra {};
+
+struct LeftImage {
+    NUClear::clock::time_point timestamp;
+    int value;
+};
+
+struct RightImage {
+    NUClear::clock::time_point timestamp;
+    int value;
+};
+
+struct Done {};
+
+struct LeftIsEven {
+    bool operator()(const Left& l) const {
+        return l.value % 2 == 0;
+    }
+};
+
+std::vector<std::pair<int, int>> join_values;
+int trigger_counter = 0;
+std::vector<std::pair<int, int>> with_values;
+std::vector<std::pair<int, int>> filter_values;
+std::vector<std::pair<int, int>> within_values;
+
+class TestReactor : public NUClear::Reactor {
+public:
+    TestReactor(std::unique_ptr<NUClear::Environment> environment) : Reactor(std::move(environment)) {
+
+        on<Join<Left, Right>>().then([this](const Left& l, const Right& r) {
+            join_values.emplace_back(l.value, r.value);
+
+            if (join_values.size() == 3) { powerplant.shutdown(); }
+        });
+
+        on<Trigger<Left, Right>>().then([] { ++trigger_counter; });
+
+        on<Startup>().then([this] {
+            // Two lefts then a right, should join the newest left with the right
+            emit(std::make_unique<Left>(1));
+            emit(std::make_unique<Left>(2));
+            emit(std::make_unique<Right>(1));
+
+            // Two rights then a left
+            emit(std::make_unique<Right>(2));
+            emit(std::make_unique<Right>(3));
+            emit(std::make_unique<Left>(3));
+
+            // A right then a left
+            emit(std::make_unique<Right>(4));
+            emit(std::make_unique<Left>(4));
+        });
+    }
+};
+
+class RejectionReactor : public NUClear::Reactor {
+public:
+    RejectionReactor(std::unique_ptr<NUClear::Environment> environment) : Reactor(std::move(environment)) {
+
+        on<Join<Left, Right>, With<Extra>>().then([](const Left& l, const Right& r, const Extra&) {
+            with_values.emplace_back(l.value, r.value);
+        });
+
+        on<Join<Left, Right>, Filter<LeftIsEven>>().then(
+            [](const Left& l, const Right& r) { filter_values.emplace_back(l.value, r.value); });
+
+        on<JoinWithin<10, std::chrono::milliseconds, LeftImage, RightImage>>().then(
+            [](const LeftImage& l, const RightImage& r) { within_values.emplace_back(l.value, r.value); });
+
+        on<Trigger<Done>>().then([this] { powerplant.shutdown(); });
+
+        on<Startup>().then([this] {
+            // Images taken too far apart are not paired, but the right image waits for a left image that matches it
+            NUClear::clock::time_point now = NUClear::clock::now();
+            emit(std::make_unique<LeftImage>(LeftImage{now, 1}));
+            emit(std::make_unique<RightImage>(RightImage{now + std::chrono::milliseconds(50), 1}));
+            emit(std::make_unique<LeftImage>(LeftImage{now + std::chrono::milliseconds(52), 2}));
+
+            // Rejected as there is no Extra yet, and as the left is odd
+            emit(std::make_unique<Left>(1));
+            emit(std::make_unique<Right>(1));
+
+            // The right was never used by a task, so it is still new when the next left arrives
+            emit(std::make_unique<Extra>());
+            emit(std::make_unique<Left>(2));
+
+            emit(std::make_unique<Done>());
+        });
+    }
+};
+}  // namespace
+
+TEST_CASE("Testing that join only runs when all of its inputs are new", "[api][join]") {
+
+    NUClear::PowerPlant::Configuration config;
+    config.thread_count = 1;
+    NUClear::PowerPlant plant(config);
+    plant.install<TestReactor>();
+
+    plant.start();
+
+    REQUIRE(join_values == std::vector<std::pair<int, int>>({{2, 1}, {3, 3}, {4, 4}}));
+
+    // A normal trigger runs on every emission once it has both types
+    REQUIRE(trigger_counter == 6);
+}
+
+TEST_CASE("Testing that join keeps its data when another word rejects the task or it does not match", "[api][join]") {
+
+    NUClear::PowerPlant::Configuration config;
+    config.thread_count = 1;
+    NUClear::PowerPlant plant(config);
+    plant.install<RejectionReactor>();
+
+    plant.start();
+
+    REQUIRE(with_values == std::vector<std::pair<int, int>>({{2, 1}}));
+    REQUIRE(filter_values == std::vector<std::pair<int, int>>({{2, 1}}));
+    REQUIRE(within_values == std::vector<std::pair<int, int>>({{2, 1}}));
+}
@@ -0,0 +1,135 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <catch.hpp>
+#include <nuclear>
+
+namespace {
+
+struct TestMessage {
+    int value;
+
+    TestMessage(int v) : value(v){};
+};
+
+std::vector<int> latest_values;
+std::vector<int> pointer_values;
+int every_counter = 0;
+
+class TestReactor : public NUClear::Reactor {
+public:
+    TestReactor(std::unique_ptr<NUClear::Environment> environment) : Reactor(std::move(environment)) {
+
+        on<Latest<Trigger<TestMessage>>>().then([this](const TestMessage& m) {
+            latest_values.push_back(m.value);
+
+            // Once we have the first burst send a second one while we are running
+            if (m.value == 10) {
+                for (int i = 11; i <= 20; ++i) {
+                    emit(std::make_unique<TestMessage>(i));
+                }
+            }
+            else if (m.value == 20) {
+                powerplant.shutdown();
+            }
+        });
+
+        on<Latest<Trigger<TestMessage>>>().then(
+            [](std::shared_ptr<const TestMessage> m) { pointer_values.push_back(m->value); });
+
+        on<Trigger<TestMessage>>().then([] { ++every_counter; });
+
+        on<Startup>().then([this] {
+            // Send a burst of messages, only the last one should be seen by the latest reactions
+            for (int i = 1; i <= 10; ++i) {
+                emit(std::make_unique<TestMessage>(i));
+            }
+        });
+    }
+};
+
+struct Required {};
+struct Finished {};
+
+struct IsOdd {
+    bool operator()(const TestMessage& m) const {
+        return m.value % 2 == 1;
+    }
+};
+
+std::vector<int> with_values;
+std::vector<int> filter_values;
+
+class RejectionReactor : public NUClear::Reactor {
+public:
+    RejectionReactor(std::unique_ptr<NUClear::Environment> environment) : Reactor(std::move(environment)) {
+
+        on<Latest<Trigger<TestMessage>>, With<Required>>().then(
+            [](const TestMessage& m, const Required&) { with_values.push_back(m.value); });
+
+        on<Latest<Trigger<TestMessage>>, Filter<IsOdd>>().then(
+            [](const TestMessage& m) { filter_values.push_back(m.value); });
+
+        on<Trigger<Finished>>().then([this] { powerplant.shutdown(); });
+
+        on<Startup>().then([this] {
+            // This message is rejected by both reactions, as there is no Required message and it is even
+            emit(std::make_unique<TestMessage>(2));
+
+            // These should be conflated into a single task that runs with the newest data
+            emit(std::make_unique<Required>());
+            emit(std::make_unique<TestMessage>(3));
+            emit(std::make_unique<TestMessage>(5));
+
+            emit(std::make_unique<Finished>());
+        });
+    }
+};
+}  // namespace
+
+TEST_CASE("Testing the latest data conflation feature", "[api][latest]") {
+
+    NUClear::PowerPlant::Configuration config;
+    config.thread_count = 1;
+    NUClear::PowerPlant plant(config);
+    plant.install<TestReactor>();
+
+    plant.start();
+
+    // Each burst should have been conflated into a single task using the newest data
+    REQUIRE(latest_values == std::vector<int>({10, 20}));
+    // The second reaction was still waiting when the second burst arrived so it only ever saw the newest data
+    REQUIRE(pointer_values == std::vector<int>({20}));
+
+    // Reactions without latest still run for every message
+    REQUIRE(every_counter == 20);
+}
+
+TEST_CASE("Testing latest when the task is rejected by another word", "[api][latest][rejected]") {
+
+    NUClear::PowerPlant::Configuration config;
+    config.thread_count = 1;
+    NUClear::PowerPlant plant(config);
+    plant.install<RejectionReactor>();
+
+    plant.start();
+
+    // A rejected task must not stop the reaction from running again
+    REQUIRE(with_values == std::vector<int>({5}));
+    REQUIRE(filter_values == std::vector<int>({5}));
+}
@@ -0,0 +1,86 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <catch.hpp>
+#include <nuclear>
+#include <vector>
+
+namespace {
+
+struct Measured {};
+struct Unmeasured {};
+
+NUClear::message::ReactionStatistics measured_stats;
+NUClear::message::ReactionStatistics unmeasured_stats;
+int seen = 0;
+
+class TestReactor : public NUClear::Reactor {
+public:
+    TestReactor(std::unique_ptr<NUClear::Environment> environment) : Reactor(std::move(environment)) {
+
+        on<Trigger<Measured>, PerfCounters>().then("Measured", [] {
+            // Touch a lot of new memory so we fault in pages and spend some time
+            std::vector<char> memory(size_t(16) << 20);
+            for (size_t i = 0; i < memory.size(); i += 4096) {
+                memory[i] = char(i);
+            }
+            volatile char sink = memory[memory.size() / 2];
+            (void) sink;
+        });
+
+        on<Trigger<Unmeasured>>().then("Unmeasured", [] {});
+
+        on<Trigger<NUClear::message::ReactionStatistics>>().then(
+            [this](const NUClear::message::ReactionStatistics& stats) {
+                if (stats.identifier[0] == "Measured") { measured_stats = stats; }
+                else if (stats.identifier[0] == "Unmeasured") {
+                    unmeasured_stats = stats;
+                }
+                else {
+                    return;
+                }
+
+                if (++seen == 2) { powerplant.shutdown(); }
+            });
+
+        on<Startup>().then([this] {
+            emit(std::make_unique<Measured>());
+            emit(std::make_unique<Unmeasured>());
+        });
+    }
+};
+}  // namespace
+
+TEST_CASE("Testing measuring the performance counters of reactions", "[api][perfcounters]") {
+
+    NUClear::PowerPlant::Configuration config;
+    config.thread_count = 1;
+    NUClear::PowerPlant plant(config);
+    plant.install<TestReactor>();
+    plant.start();
+
+    // Reactions that don't ask are never measured
+    REQUIRE(unmeasured_stats.performance.task_clock == 0);
+    REQUIRE(unmeasured_stats.performance.page_faults == 0);
+
+    // Only check the measured reaction if this system lets us read counters at all
+    if (NUClear::util::PerformanceCounters::read().task_clock > 0) {
+        REQUIRE(measured_stats.performance.task_clock > 0);
+        REQUIRE(measured_stats.performance.page_faults > 0);
+    }
+}
@@ -0,0 +1,179 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <catch.hpp>
+#include <cstdio>
+#include <fstream>
+#include <nuclear>
+
+namespace {
+
+struct Calibration {
+    int offset;
+    double scale;
+};
+
+struct Go {};
+
+struct Setting {
+    int value;
+};
+
+const char* snapshot_path = "nuclear_persist_test.snapshot";
+
+// The calibration that the second run of the system saw
+int seen_offset    = 0;
+double seen_scale  = 0;
+bool seen_at_start = false;
+
+// If restoring the calibration while running let a reaction persist another type
+bool rebound = false;
+
+class Producer : public NUClear::Reactor {
+public:
+    Producer(std::unique_ptr<NUClear::Environment> environment) : Reactor(std::move(environment)) {
+
+        emit<Scope::INITIALIZE>(std::make_unique<NUClear::message::PersistenceConfiguration>(snapshot_path));
+
+        on<Trigger<Go>, Persist<Calibration>>().then([](const Calibration&) {
+            // Nothing to do, we only need the type to be persisted
+        });
+
+        on<Startup>().then([this] {
+            emit(std::make_unique<Calibration>(Calibration{5, 2.5}));
+            powerplant.shutdown();
+        });
+    }
+};
+
+// Leaves different calibration in the store without touching the snapshot
+class Leftover : public NUClear::Reactor {
+public:
+    Leftover(std::unique_ptr<NUClear::Environment> environment) : Reactor(std::move(environment)) {
+
+        on<Startup>().then([this] {
+            emit(std::make_unique<Calibration>(Calibration{7, 1.0}));
+            powerplant.shutdown();
+        });
+    }
+};
+
+class Consumer : public NUClear::Reactor {
+public:
+    Consumer(std::unique_ptr<NUClear::Environment> environment) : Reactor(std::move(environment)) {
+
+        emit<Scope::INITIALIZE>(std::make_unique<NUClear::message::PersistenceConfiguration>(snapshot_path));
+
+        on<Trigger<Go>, Persist<Calibration>>().then([this](const Calibration& calibration) {
+            seen_offset = calibration.offset;
+            seen_scale  = calibration.scale;
+            powerplant.shutdown();
+        });
+
+        on<Startup, Optional<With<Calibration>>>().then([this](std::shared_ptr<const Calibration> calibration) {
+            seen_at_start = bool(calibration);
+            emit(std::make_unique<Go>());
+        });
+    }
+};
+
+// Configures persistence once running, so the calibration is restored with a direct emit
+class Rebinder : public NUClear::Reactor {
+public:
+    Rebinder(std::unique_ptr<NUClear::Environment> environment) : Reactor(std::move(environment)) {
+
+        on<Trigger<Go>, Persist<Calibration>>().then([](const Calibration&) {});
+
+        on<Trigger<Calibration>>().then([this] {
+            // Binding a Persist while the calibration is being restored must not wait on the restore
+            on<Trigger<Go>, Persist<Setting>>().then([](const Setting&) {});
+            rebound = true;
+            powerplant.shutdown();
+        });
+
+        on<Startup>().then([this] {
+            emit(std::make_unique<NUClear::message::PersistenceConfiguration>(snapshot_path));
+        });
+    }
+};
+}  // namespace
+
+TEST_CASE("Testing persisting data across a restart", "[api][persist]") {
+
+    std::remove(snapshot_path);
+
+    // The first run writes the calibration to the snapshot as it shuts down
+    {
+        NUClear::PowerPlant::Configuration config;
+        config.thread_count = 1;
+        NUClear::PowerPlant plant(config);
+        plant.install<Producer>();
+        plant.start();
+    }
+
+    REQUIRE(std::ifstream(snapshot_path).good());
+
+    // A run in between must not leave its calibration behind for the next run to see instead of the snapshot
+    {
+        NUClear::PowerPlant::Configuration config;
+        config.thread_count = 1;
+        NUClear::PowerPlant plant(config);
+        plant.install<Leftover>();
+        plant.start();
+    }
+
+    // The last run restores it from the snapshot before it starts
+    {
+        NUClear::PowerPlant::Configuration config;
+        config.thread_count = 1;
+        NUClear::PowerPlant plant(config);
+        plant.install<Consumer>();
+        plant.start();
+    }
+
+    std::remove(snapshot_path);
+
+    REQUIRE(seen_at_start);
+    REQUIRE(seen_offset == 5);
+    REQUIRE(seen_scale == 2.5);
+}
+
+TEST_CASE("Testing binding a persisted type while restoring another", "[api][persist]") {
+
+    std::remove(snapshot_path);
+
+    {
+        NUClear::PowerPlant::Configuration config;
+        config.thread_count = 1;
+        NUClear::PowerPlant plant(config);
+        plant.install<Producer>();
+        plant.start();
+    }
+
+    {
+        NUClear::PowerPlant::Configuration config;
+        config.thread_count = 1;
+        NUClear::PowerPlant plant(config);
+        plant.install<Rebinder>();
+        plant.start();
+    }
+
+    std::remove(snapshot_path);
+
+    REQUIRE(rebound);
+}
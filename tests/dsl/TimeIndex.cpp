@@ -0,0 +1,95 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <catch.hpp>
+
+#include <nuclear>
+
+namespace {
+
+using NUClear::clock;
+
+const clock::time_point epoch = clock::now();
+
+struct Odometry {
+    Odometry(int v) : timestamp(epoch + std::chrono::milliseconds(v)), value(v) {}
+
+    clock::time_point timestamp;
+    int value;
+};
+
+struct Image {
+    Image(int v) : timestamp(epoch + std::chrono::milliseconds(v)) {}
+
+    clock::time_point timestamp;
+};
+
+std::vector<int> nearest_values;
+std::vector<int> before_values;
+std::vector<int> after_values;
+std::vector<double> fractions;
+
+class TestReactor : public NUClear::Reactor {
+public:
+    TestReactor(std::unique_ptr<NUClear::Environment> environment) : Reactor(std::move(environment)) {
+
+        on<Trigger<Image>, With<Nearest<Odometry>>>().then(
+            [](const Image&, const Odometry& odometry) { nearest_values.push_back(odometry.value); });
+
+        on<Trigger<Image>, With<Between<Odometry, 5>>>().then([](const Image&, const Between<Odometry, 5>& b) {
+            before_values.push_back(b.before->value);
+            after_values.push_back(b.after->value);
+            fractions.push_back(b.fraction());
+        });
+
+        on<Trigger<Image>>().then([this](const Image& image) {
+            if (image.timestamp - epoch == std::chrono::milliseconds(200)) { powerplant.shutdown(); }
+        });
+
+        on<Startup>().then([this] {
+            // Emit our odometry out of order, it must still be searched in time order
+            for (int v : {0, 10, 30, 20, 40, 50, 60, 70, 80, 90}) {
+                emit(std::make_unique<Odometry>(v));
+            }
+
+            // Exactly on a time, between two times, and after all the times
+            emit(std::make_unique<Image>(60));
+            emit(std::make_unique<Image>(64));
+            emit(std::make_unique<Image>(200));
+        });
+    }
+};
+}  // namespace
+
+TEST_CASE("Testing looking up data by its timestamp", "[api][nearest][between]") {
+
+    NUClear::PowerPlant::Configuration config;
+    config.thread_count = 1;
+    NUClear::PowerPlant plant(config);
+    plant.install<TestReactor>();
+
+    plant.start();
+
+    REQUIRE(nearest_values == std::vector<int>({60, 60, 90}));
+
+    // The last image can't be interpolated so it should not run, and only the last 5 odometry values are kept
+    REQUIRE(before_values == std::vector<int>({60, 60}));
+    REQUIRE(after_values == std::vector<int>({60, 70}));
+    REQUIRE(fractions[0] == Approx(0.0));
+    REQUIRE(fractions[1] == Approx(0.4));
+}
@@ -0,0 +1,99 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <catch.hpp>
+#include <nuclear>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Anonymous namespace to keep everything file local
+namespace {
+
+std::vector<std::string> messages;
+std::vector<bool> had_task;
+std::thread::id logging_thread;
+std::thread::id handling_thread;
+
+class TestReactor : public NUClear::Reactor {
+public:
+    TestReactor(std::unique_ptr<NUClear::Environment> environment) : Reactor(std::move(environment)) {
+
+        on<Trigger<NUClear::message::LogMessage>>().then([this](const NUClear::message::LogMessage& log_message) {
+            messages.push_back(log_message.message);
+            had_task.push_back(log_message.task != nullptr);
+            handling_thread = std::this_thread::get_id();
+
+            if (messages.size() == 3) { powerplant.shutdown(); }
+        });
+
+        on<Trigger<int>>().then([this](const int& v) {
+            logging_thread = std::this_thread::get_id();
+
+            // Numbers and strings are formatted later by the log controller
+            log<NUClear::DEBUG>("Got int:", v, std::string("and"), 2.5);
+
+            // Below the level of this reactor so never logged, even from the free function
+            log<NUClear::TRACE>("Should not log");
+            NUClear::log<NUClear::TRACE>("Should not log");
+
+            // Too many arguments to keep in the queue, so these are formatted straight away
+            NUClear::log<NUClear::INFO>(std::string("a"),
+                                        std::string("b"),
+                                        std::string("c"),
+                                        std::string("d"),
+                                        std::string("e"),
+                                        std::string("f"));
+        });
+
+        on<Startup>().then([] { NUClear::log<NUClear::INFO>("Outside a task", 1); });
+
+        // This runs after the log controller has stopped consuming, so it is only emitted once the threads stop
+        on<Shutdown>().then([this] { log<NUClear::INFO>("Shutting down"); });
+    }
+};
+}  // namespace
+
+TEST_CASE("Testing logging asynchronously", "[api][log][async]") {
+
+    NUClear::PowerPlant::Configuration config;
+    config.thread_count  = 1;
+    config.async_logging = true;
+    NUClear::PowerPlant plant(config);
+
+    plant.install<TestReactor, NUClear::DEBUG>();
+
+    plant.emit(std::make_unique<int>(5));
+
+    plant.start();
+
+    REQUIRE(messages.size() == 4);
+    REQUIRE(messages.back() == "Shutting down");
+
+    // Messages from the same thread stay in order, but the startup message was logged from another thread
+    std::vector<std::string> task_messages;
+    for (size_t i = 0; i + 1 < messages.size(); ++i) {
+        if (messages[i] == "Outside a task 1") { continue; }
+        task_messages.push_back(messages[i]);
+        REQUIRE(had_task[i]);
+    }
+    REQUIRE(task_messages == std::vector<std::string>{"Got int: 5 and 2.5", "a b c d e f"});
+
+    // The log messages were handled by the log controller rather than the reaction that logged them
+    REQUIRE(handling_thread != logging_thread);
+}